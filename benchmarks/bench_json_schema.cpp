@@ -0,0 +1,105 @@
+/**
+ * @file bench_json_schema.cpp
+ * @brief Benchmark for JSON Schema validation of parser contents
+ *
+ * Validates a pool of configurations against a draft-07 schema exported
+ * from a ConfigSchema: converting each configuration to JSON (the cost a
+ * JSON-document validator pays before it starts), compiling the schema on
+ * every call, and compiling it once with CompiledJsonSchema.
+ *
+ * Usage: bench_json_schema [validations] [distinct_configs]
+ *
+ * @author Michele Bigi
+ * @date 2025-12-02
+ */
+
+#include "ioc_config/oop_parser.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+using namespace ioc_config;
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Default schema plus a few constrained and enumerated parameters
+ */
+nlohmann::json makeSchema() {
+    ConfigSchema schema = OopParser::createDefaultSchema();
+    const char* search_keys[] = {"max_magnitude", "min_diameter", "max_distance", "min_elongation"};
+    for (const char* key : search_keys) {
+        ParameterSpec spec;
+        spec.key = key;
+        spec.required = true;
+        spec.constraint.parseExpression("0..100");
+        schema.sections["search"].addParameter(spec);
+    }
+    ParameterSpec mode;
+    mode.key = "mode";
+    mode.required = true;
+    mode.allowed_values = {"fast", "normal", "precise", "debug", "survey", "followup"};
+    schema.sections["search"].addParameter(mode);
+    schema.addConstraint("search.max_distance > search.min_diameter");
+    return schema.toJsonSchema();
+}
+
+int main(int argc, char** argv) {
+    size_t validations = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 50000;
+    size_t distinct = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 5000;
+
+    const char* modes[] = {"survey", "precise", "followup", "bogus"};
+    std::vector<std::unique_ptr<OopParser>> configs;
+    for (size_t i = 0; i < distinct; ++i) {
+        auto parser = std::make_unique<OopParser>();
+        parser->setParameter("object", "id", std::to_string(10000 + i));
+        parser->setParameter("object", "name", "'Asteroid " + std::to_string(i) + "'");
+        parser->setParameter("time", "start_date", "'2025-11-25'");
+        parser->setParameter("time", "end_date", "'2025-12-02'");
+        parser->setParameter("search", "max_magnitude", std::to_string(10 + i % 15));
+        parser->setParameter("search", "min_diameter", std::to_string((i % 7) * 0.5));
+        parser->setParameter("search", "max_distance", std::to_string(90 + i % 20));
+        parser->setParameter("search", "min_elongation", "45.0");
+        parser->setParameter("search", "mode", modes[i % 4]);
+        parser->setParameter("propag", "step_size", "0.5");
+        configs.push_back(std::move(parser));
+    }
+
+    const nlohmann::json schema = makeSchema();
+
+    std::cout << "\n==================================================\n";
+    std::cout << "  JSON Schema Validation Benchmark\n";
+    std::cout << "==================================================\n";
+    std::cout << validations << " validations over " << distinct << " configs\n\n";
+
+    std::vector<std::string> errors;
+    auto run = [&](const char* name, auto&& validate) {
+        size_t invalid = 0;
+        auto start = Clock::now();
+        for (size_t i = 0; i < validations; ++i) {
+            invalid += !validate(*configs[i % configs.size()]);
+        }
+        double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        std::cout << std::left << std::setw(30) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(10) << ms << " ms" << std::setw(12) << validations / ms * 1000.0
+                  << " configs/s  (" << invalid << " invalid)\n";
+    };
+
+    run("toJson() only", [&](const OopParser& config) { return !config.toJson().empty(); });
+    run("JSON schema per call", [&](const OopParser& config) {
+        return config.validateAgainstSchema(schema, errors);
+    });
+
+    auto start = Clock::now();
+    CompiledJsonSchema compiled(schema);
+    double compile_us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    run("CompiledJsonSchema", [&](const OopParser& config) {
+        return config.validateAgainstSchema(compiled, errors);
+    });
+    std::cout << "(compiling the schema took " << std::setprecision(1) << compile_us << " us)\n\n";
+
+    return 0;
+}
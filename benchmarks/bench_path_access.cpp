@@ -0,0 +1,126 @@
+/**
+ * @file bench_path_access.cpp
+ * @brief Benchmark for string path access versus compiled PathHandle
+ *
+ * Mimics a per-asteroid hot loop that reads and updates the same dozen
+ * parameters of a configuration many times, plus existence checks and
+ * typed reads that avoid building strings. A second pass applies 10k
+ * updates (a tuning run's results) one call at a time and as one batch.
+ *
+ * Usage: bench_path_access [iterations]
+ *
+ * @author Michele Bigi
+ * @date 2025-12-02
+ */
+
+#include "ioc_config/oop_parser.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+using namespace ioc_config;
+using Clock = std::chrono::steady_clock;
+
+int main(int argc, char** argv) {
+    size_t iterations = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000;
+
+    OopParser parser;
+    for (size_t s = 0; s < 12; ++s) {
+        for (size_t p = 0; p < 40; ++p) {
+            parser.setParameter("section_" + std::to_string(s), ".param_" + std::to_string(p),
+                                std::to_string(p * 0.5));
+        }
+    }
+
+    std::vector<std::string> paths;
+    for (size_t i = 0; i < 12; ++i) {
+        paths.push_back("/section_" + std::to_string(i) + "/.param_" + std::to_string(i * 3));
+    }
+    std::vector<PathHandle> handles(paths.begin(), paths.end());
+
+    std::cout << "\n==================================================\n";
+    std::cout << "  Path Access Benchmark: strings vs PathHandle\n";
+    std::cout << "==================================================\n";
+    std::cout << iterations << " iterations x " << paths.size() << " paths\n\n";
+
+    size_t checksum = 0;
+    auto time = [&](const char* name, auto&& body) {
+        auto start = Clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            body(i);
+        }
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        std::cout << std::left << std::setw(28) << name << std::right << std::fixed
+                  << std::setprecision(1) << std::setw(10) << ns / (iterations * paths.size())
+                  << " ns/access\n";
+    };
+
+    time("get (string path)", [&](size_t) {
+        for (const auto& path : paths) checksum += parser.getValueByPath(path).size();
+    });
+    time("get (PathHandle)", [&](size_t) {
+        for (const auto& handle : handles) checksum += parser.getValueByPath(handle).size();
+    });
+    time("hasPath", [&](size_t) {
+        for (const auto& path : paths) checksum += parser.hasPath(path);
+    });
+    time("getDoubleByPath (string)", [&](size_t) {
+        double value = 0;
+        for (const auto& path : paths) checksum += parser.getDoubleByPath(path, value);
+    });
+    time("getDoubleByPath (handle)", [&](size_t) {
+        double value = 0;
+        for (const auto& handle : handles) checksum += parser.getDoubleByPath(handle, value);
+    });
+    time("set (string path)", [&](size_t i) {
+        for (const auto& path : paths) parser.setValueByPath(path, (i & 1) ? "1.5" : "2.5");
+    });
+    time("set (PathHandle)", [&](size_t i) {
+        for (const auto& handle : handles) parser.setValueByPath(handle, (i & 1) ? "1.5" : "2.5");
+    });
+
+    // Batched updates across a larger configuration
+    OopParser large;
+    for (size_t s = 0; s < 100; ++s) {
+        for (size_t p = 0; p < 200; ++p) {
+            large.setParameter("section_" + std::to_string(s), "param_" + std::to_string(p), "0");
+        }
+    }
+    std::vector<std::pair<std::string, std::string>> updates;
+    for (size_t i = 0; i < 10000; ++i) {
+        updates.emplace_back("/section_" + std::to_string((i * 37) % 100) + "/param_" +
+                                 std::to_string((i * 11) % 200),
+                             std::to_string(i * 0.25));
+    }
+    std::vector<std::string> update_paths;
+    for (const auto& update : updates) {
+        update_paths.push_back(update.first);
+    }
+
+    auto time_batch = [&](const char* name, auto&& body) {
+        const int rounds = 20;
+        auto start = Clock::now();
+        for (int r = 0; r < rounds; ++r) {
+            body();
+        }
+        double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / rounds;
+        std::cout << std::left << std::setw(28) << name << std::right << std::fixed
+                  << std::setprecision(2) << std::setw(10) << ms << " ms/10k\n";
+    };
+
+    std::cout << "\n10k updates on 100 sections x 200 params:\n";
+    time_batch("setValueByPath loop", [&] {
+        for (const auto& update : updates) large.setValueByPath(update.first, update.second);
+    });
+    time_batch("setValuesByPaths", [&] { large.setValuesByPaths(updates); });
+    time_batch("getValueByPath loop", [&] {
+        for (const auto& path : update_paths) checksum += large.getValueByPath(path).size();
+    });
+    time_batch("getValuesByPaths", [&] { checksum += large.getValuesByPaths(update_paths).size(); });
+
+    std::cout << "\n(checksum " << checksum << ")\n\n";
+    return 0;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file bench_pattern_search.cpp
+ * @brief Benchmark for value pattern search, fast matchers vs std::regex
+ *
+ * Fills a configuration with a few hundred thousand values and searches
+ * it with common pattern shapes, comparing CompiledPattern against a plain
+ * std::regex_search scan (what getParametersByValuePattern used to do).
+ *
+ * Usage: bench_pattern_search [parameters]
+ *
+ * @author Michele Bigi
+ * @date 2025-12-02
+ */
+
+#include "ioc_config/oop_parser.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <regex>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+using namespace ioc_config;
+using Clock = std::chrono::steady_clock;
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000;
+
+    const char* names[] = {"Ceres", "Pallas", "Juno", "Vesta", "Apophis", "Bennu", "Eros", "Ida"};
+    OopParser parser;
+    for (size_t i = 0; i < count; ++i) {
+        std::string value = (i % 3 == 0) ? "'" + std::string(names[i % 8]) + " asteroid " + std::to_string(i) + "'"
+                          : (i % 3 == 1) ? std::to_string(i * 0.37) : "obs_" + std::to_string(i) + ".dat";
+        parser.setParameter("section_" + std::to_string(i % 100), "param_" + std::to_string(i), value);
+    }
+
+    const std::vector<ConfigSectionData> sections = parser.getAllSections();
+
+    std::cout << "\n==================================================\n";
+    std::cout << "  Pattern Search Benchmark: fast matchers vs std::regex\n";
+    std::cout << "==================================================\n";
+    std::cout << count << " values\n\n";
+
+    const char* kinds[] = {"LITERAL", "PREFIX", "SUFFIX", "EXACT", "GLOB", "REGEX"};
+    const std::vector<std::string> patterns = {
+        "apophis", "^obs_1", "\\.dat$", "^'vesta asteroid 3'$", "^'ceres.*[0-9]", "^obs_.*7\\.dat$", "[0-9]+\\.5"
+    };
+
+    std::cout << std::left << std::setw(24) << "Pattern" << std::setw(9) << "Kind" << std::right
+              << std::setw(10) << "Matches" << std::setw(14) << "std::regex" << std::setw(14) << "Compiled"
+              << std::setw(10) << "Speedup" << "\n";
+
+    for (const auto& pattern : patterns) {
+        std::regex reference(pattern, std::regex::icase);
+        size_t reference_matches = 0;
+        auto start = Clock::now();
+        for (const auto& section : sections) {
+            for (const auto& [key, param] : section.parameters) {
+                reference_matches += std::regex_search(param.value, reference);
+            }
+        }
+        double regex_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        CompiledPattern compiled(pattern);
+        start = Clock::now();
+        size_t matches = parser.forEachParameterByValuePattern(
+            compiled, [](const ConfigSectionData&, const ConfigParameter&) {});
+        double fast_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        std::cout << std::left << std::setw(24) << pattern << std::setw(9)
+                  << kinds[static_cast<int>(compiled.getKind())] << std::right << std::setw(10) << matches
+                  << std::fixed << std::setprecision(1) << std::setw(11) << regex_ms << " ms"
+                  << std::setw(11) << fast_ms << " ms" << std::setw(9) << regex_ms / fast_ms << "x"
+                  << (matches == reference_matches ? "" : "  MISMATCH") << "\n";
+    }
+
+    std::cout << "\n";
+    return 0;
+}
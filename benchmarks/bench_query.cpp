@@ -0,0 +1,95 @@
+/**
+ * @file bench_query.cpp
+ * @brief Benchmark for query expressions vs hand-written predicates
+ *
+ * Builds a large configuration and runs the same filters as a ConfigQuery
+ * (which can use the section list and type index) and as a std::function
+ * predicate passed to forEachParameterWhere (a full scan).
+ *
+ * Usage: bench_query [sections] [params_per_section]
+ *
+ * @author Michele Bigi
+ * @date 2025-12-02
+ */
+
+#include "ioc_config/oop_parser.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+using namespace ioc_config;
+using Clock = std::chrono::steady_clock;
+
+struct Case {
+    std::string expression;
+    std::function<bool(const ConfigSectionData&, const ConfigParameter&)> predicate;
+};
+
+int main(int argc, char** argv) {
+    size_t sections = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200;
+    size_t params = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 5000;
+
+    OopParser parser;
+    for (size_t s = 0; s < sections; ++s) {
+        std::string section = "section_" + std::to_string(s);
+        for (size_t p = 0; p < params; ++p) {
+            // Mix of int, float and string values
+            std::string value = (p % 3 == 0) ? std::to_string(p)
+                              : (p % 3 == 1) ? std::to_string(p * 0.5) : "'text " + std::to_string(p) + "'";
+            parser.setParameter(section, "param_" + std::to_string(p), value);
+        }
+    }
+
+    std::cout << "\n==================================================\n";
+    std::cout << "  Query Benchmark: expressions vs predicates\n";
+    std::cout << "==================================================\n";
+    std::cout << sections << " sections x " << params << " params\n\n";
+
+    auto number = [](const ConfigParameter& param) { return std::strtod(param.value.c_str(), nullptr); };
+    std::vector<Case> cases = {
+        {"section=section_42 AND type=float AND value>100",
+         [&](const ConfigSectionData& s, const ConfigParameter& p) {
+             return s.name == "section_42" && p.type == "float" && number(p) > 100;
+         }},
+        {"type=int AND value>=4990",
+         [&](const ConfigSectionData&, const ConfigParameter& p) { return p.type == "int" && number(p) >= 4990; }},
+        {"value>1400 AND key~'^param_1'",
+         [&](const ConfigSectionData&, const ConfigParameter& p) {
+             return p.type != "string" && number(p) > 1400 && p.key.compare(0, 7, "param_1") == 0;
+         }},
+    };
+
+    std::cout << std::left << std::setw(50) << "Query" << std::right << std::setw(10) << "Matches"
+              << std::setw(14) << "Predicate" << std::setw(14) << "Query" << "\n";
+
+    // Build the type index once so the first case does not pay for it
+    parser.getParameterCountsByType();
+
+    for (const auto& c : cases) {
+        ConfigQuery query(c.expression);
+
+        auto start = Clock::now();
+        size_t predicate_matches = 0;
+        parser.forEachSection([&](const ConfigSectionData& section) {
+            for (const auto& [key, param] : section.parameters) {
+                predicate_matches += c.predicate(section, param);
+            }
+        });
+        double predicate_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        start = Clock::now();
+        size_t matches = parser.queryParameters(query, [](const ConfigSectionData&, const ConfigParameter&) {});
+        double query_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        std::cout << std::left << std::setw(50) << c.expression << std::right << std::setw(10) << matches
+                  << std::fixed << std::setprecision(2) << std::setw(11) << predicate_ms << " ms"
+                  << std::setw(11) << query_ms << " ms"
+                  << (matches == predicate_matches ? "" : "  MISMATCH") << "\n";
+    }
+
+    std::cout << "\n";
+    return 0;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file bench_schema_validation.cpp
+ * @brief Benchmark for schema validation, ConfigSchema vs CompiledSchema
+ *
+ * Validates a stream of configurations (a pool of distinct configs reused
+ * round-robin) against one schema, first walking the ConfigSchema on every
+ * call, then with the schema compiled once, then with the compiled schema
+ * in full-coverage mode (every parameter checked, unknown keys reported).
+ * A last pass edits one parameter of a large configuration at a time and
+ * compares full revalidation with incremental revalidate().
+ *
+ * Usage: bench_schema_validation [validations] [distinct_configs]
+ *
+ * @author Michele Bigi
+ * @date 2025-12-02
+ */
+
+#include "ioc_config/oop_parser.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+using namespace ioc_config;
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Default schema plus a few constrained and enumerated parameters
+ */
+ConfigSchema makeSchema() {
+    ConfigSchema schema = OopParser::createDefaultSchema();
+    const char* search_keys[] = {"max_magnitude", "min_diameter", "max_distance", "min_elongation"};
+    for (const char* key : search_keys) {
+        ParameterSpec spec;
+        spec.key = key;
+        spec.required = true;
+        spec.constraint.parseExpression("0..100");
+        schema.sections["search"].addParameter(spec);
+    }
+    ParameterSpec mode;
+    mode.key = "mode";
+    mode.required = true;
+    mode.allowed_values = {"fast", "normal", "precise", "debug", "survey", "followup"};
+    schema.sections["search"].addParameter(mode);
+    return schema;
+}
+
+int main(int argc, char** argv) {
+    size_t validations = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 50000;
+    size_t distinct = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 5000;
+
+    const char* modes[] = {"survey", "precise", "followup", "bogus"};
+    std::vector<std::unique_ptr<OopParser>> configs;
+    for (size_t i = 0; i < distinct; ++i) {
+        auto parser = std::make_unique<OopParser>();
+        parser->setParameter("object", "id", std::to_string(10000 + i));
+        parser->setParameter("object", "name", "'Asteroid " + std::to_string(i) + "'");
+        parser->setParameter("time", "start_date", "'2025-11-25'");
+        parser->setParameter("time", "end_date", "'2025-12-02'");
+        parser->setParameter("search", "max_magnitude", std::to_string(10 + i % 15));
+        parser->setParameter("search", "min_diameter", std::to_string((i % 7) * 0.5));
+        parser->setParameter("search", "max_distance", std::to_string(90 + i % 20));
+        parser->setParameter("search", "min_elongation", "45.0");
+        parser->setParameter("search", "mode", modes[i % 4]);
+        parser->setParameter("propag", "step_size", "0.5");
+        configs.push_back(std::move(parser));
+    }
+
+    const ConfigSchema schema = makeSchema();
+
+    std::cout << "\n==================================================\n";
+    std::cout << "  Schema Validation Benchmark\n";
+    std::cout << "==================================================\n";
+    std::cout << validations << " validations over " << distinct << " configs\n\n";
+
+    std::vector<std::string> errors;
+    auto run = [&](const char* name, auto&& validate) {
+        size_t invalid = 0;
+        auto start = Clock::now();
+        for (size_t i = 0; i < validations; ++i) {
+            invalid += !validate(*configs[i % configs.size()]);
+        }
+        double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        std::cout << std::left << std::setw(30) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(10) << ms << " ms" << std::setw(12) << validations / ms * 1000.0
+                  << " configs/s  (" << invalid << " invalid)\n";
+    };
+
+    run("ConfigSchema", [&](const OopParser& config) { return config.validateWithSchema(schema, errors); });
+
+    auto start = Clock::now();
+    CompiledSchema compiled(schema);
+    double compile_us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    run("CompiledSchema", [&](const OopParser& config) { return config.validateWithSchema(compiled, errors); });
+    std::vector<ValidationIssue> issues;
+    run("CompiledSchema (full)", [&](const OopParser& config) { return config.validateFull(compiled, issues); });
+    std::cout << "(compiling the schema took " << std::setprecision(1) << compile_us << " us)\n\n";
+
+    // Edit-then-validate loop on one large configuration
+    const size_t sections = 1000, edits = 2000;
+    OopParser large;
+    for (size_t s = 0; s < sections; ++s) {
+        for (size_t p = 0; p < 20; ++p) {
+            large.setParameter("section_" + std::to_string(s), "param_" + std::to_string(p), std::to_string(p));
+        }
+    }
+    large.setSchema(schema);
+    large.revalidate();
+
+    std::cout << edits << " single-parameter edits on " << sections << " sections x 20 params:\n";
+    for (int incremental = 0; incremental < 2; ++incremental) {
+        auto t0 = Clock::now();
+        size_t invalid = 0;
+        for (size_t e = 0; e < edits; ++e) {
+            large.setParameter("section_" + std::to_string(e * 7 % sections), "param_3", std::to_string(e));
+            invalid += incremental ? !large.revalidate() : !large.validateFull(compiled, issues);
+        }
+        double ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+        std::cout << std::left << std::setw(30) << (incremental ? "revalidate()" : "validateFull()")
+                  << std::right << std::setw(10) << ms << " ms" << std::setw(12) << ms * 1000.0 / edits
+                  << " us/edit  (" << invalid << " invalid)\n";
+    }
+    std::cout << "\n";
+
+    return 0;
+}
@@ -0,0 +1,124 @@
+/**
+ * @file bench_versioning.cpp
+ * @brief Benchmark for VersionedOopParser history storage modes
+ *
+ * Builds a large configuration, records a series of versions with a few
+ * parameter edits each, then reports history memory and rollback latency
+ * for full snapshots versus keyframe + delta storage. A second pass records
+ * 1000 versions with a single parameter edit each to show how much of the
+ * configuration is shared between snapshots.
+ *
+ * Usage: bench_versioning [sections] [params_per_section] [versions]
+ *
+ * @author Michele Bigi
+ * @date 2025-12-02
+ */
+
+#include "ioc_config/oop_parser.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <string>
+#include <cstdlib>
+
+using namespace ioc_config;
+using Clock = std::chrono::steady_clock;
+
+struct BenchResult {
+    double create_ms;
+    double rollback_avg_us;
+    double rollback_max_us;
+    size_t history_bytes;
+};
+
+/**
+ * @brief Fill a parser with sections x params entries
+ */
+void populate(OopParser& parser, size_t sections, size_t params) {
+    for (size_t s = 0; s < sections; ++s) {
+        std::string section = "section_" + std::to_string(s);
+        for (size_t p = 0; p < params; ++p) {
+            parser.setParameter(section, "param_" + std::to_string(p),
+                                "'value for parameter " + std::to_string(p) +
+                                " of section " + std::to_string(s) + "'");
+        }
+    }
+}
+
+/**
+ * @brief Record versions and time rollbacks for one storage mode
+ */
+BenchResult run(VersionStorageMode mode, size_t sections, size_t params, size_t versions,
+                size_t edits = 3) {
+    VersionedOopParser parser;
+    parser.setStorageMode(mode, 16);
+    populate(parser, sections, params);
+    parser.enableVersioning("Initial");
+
+    BenchResult result{};
+
+    auto start = Clock::now();
+    for (size_t v = 1; v < versions; ++v) {
+        // A tuning step touches a handful of parameters
+        for (size_t k = 0; k < edits; ++k) {
+            std::string section = "section_" + std::to_string((v * 7 + k) % sections);
+            std::string key = "param_" + std::to_string((v * 13 + k) % params);
+            parser.setParameter(section, key, std::to_string(v * 0.001 + k));
+        }
+        parser.createVersion("Step " + std::to_string(v));
+    }
+    result.create_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    result.history_bytes = parser.getHistoryMemoryUsage();
+
+    double total_us = 0;
+    size_t rollbacks = 0;
+    for (size_t v = versions; v >= 1; v = (v > 7 ? v - 7 : 0)) {
+        auto t0 = Clock::now();
+        parser.rollback(v);
+        double us = std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+        total_us += us;
+        result.rollback_max_us = std::max(result.rollback_max_us, us);
+        rollbacks++;
+    }
+    result.rollback_avg_us = rollbacks ? total_us / rollbacks : 0;
+
+    return result;
+}
+
+int main(int argc, char** argv) {
+    size_t sections = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 50;
+    size_t params = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 400;
+    size_t versions = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 200;
+
+    std::cout << "\n==================================================\n";
+    std::cout << "  Versioning Benchmark: full snapshots vs deltas\n";
+    std::cout << "==================================================\n";
+
+    OopParser sample;
+    populate(sample, sections, params);
+    std::cout << "Config: " << sections << " sections x " << params << " params ("
+              << sample.getMemoryUsage() / 1024 << " KiB), " << versions << " versions\n\n";
+
+    auto report = [](const std::string& name, const BenchResult& r) {
+        std::cout << std::left << std::setw(16) << name << std::right
+                  << std::setw(12) << std::fixed << std::setprecision(1) << r.create_ms << " ms"
+                  << std::setw(14) << r.history_bytes / 1024 << " KiB"
+                  << std::setw(14) << r.rollback_avg_us << " us"
+                  << std::setw(14) << r.rollback_max_us << " us\n";
+    };
+
+    std::cout << std::left << std::setw(16) << "Mode" << std::right
+              << std::setw(15) << "Create" << std::setw(18) << "History"
+              << std::setw(17) << "Rollback avg" << std::setw(17) << "Rollback max" << "\n";
+    report("FULL_SNAPSHOT", run(VersionStorageMode::FULL_SNAPSHOT, sections, params, versions));
+    report("DELTA (k=16)", run(VersionStorageMode::DELTA, sections, params, versions));
+
+    const size_t single_versions = 1000;
+    std::cout << "\nSingle-parameter edits, " << single_versions << " versions (unshared copies would need "
+              << sample.getMemoryUsage() / 1024 * single_versions << " KiB):\n";
+    report("FULL_SNAPSHOT", run(VersionStorageMode::FULL_SNAPSHOT, sections, params, single_versions, 1));
+    report("DELTA (k=16)", run(VersionStorageMode::DELTA, sections, params, single_versions, 1));
+    std::cout << "\n";
+
+    return 0;
+}
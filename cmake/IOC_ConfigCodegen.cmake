@@ -0,0 +1,58 @@
+# IOC_ConfigCodegen.cmake
+#
+# ioc_config_generate_structs(OUTPUT <header>
+#                             [NAMESPACE <namespace>]
+#                             [STRUCT <name>]
+#                             [SCHEMA <schema.json>])
+#
+# Runs `ioc-config generate-structs` at build time to write <header>: one
+# plain struct per section of the schema and an inline
+# load<name>(const ioc_config::OopParser&, <name>&) that fills them in one
+# pass. SCHEMA names a JSON Schema file such as the one written by
+# `ioc-config export-schema` (relative paths are taken from the current
+# source directory); the header is regenerated when it changes. Without
+# SCHEMA the default schema is used. Add <header> to a target's sources (or depend on it) so it is
+# generated before that target compiles. The ioc-config target is used when
+# it is part of the build, otherwise the program named by IOC_CONFIG_CLI.
+
+function(ioc_config_generate_structs)
+    cmake_parse_arguments(ARG "" "OUTPUT;NAMESPACE;STRUCT;SCHEMA" "" ${ARGN})
+    if(NOT ARG_OUTPUT)
+        message(FATAL_ERROR "ioc_config_generate_structs: OUTPUT is required")
+    endif()
+    if(NOT ARG_NAMESPACE)
+        set(ARG_NAMESPACE ioc_config_generated)
+    endif()
+    if(NOT ARG_STRUCT)
+        set(ARG_STRUCT Config)
+    endif()
+
+    if(TARGET ioc-config)
+        set(generator $<TARGET_FILE:ioc-config>)
+        set(generator_depends ioc-config)
+    else()
+        find_program(IOC_CONFIG_CLI ioc-config)
+        if(NOT IOC_CONFIG_CLI)
+            message(FATAL_ERROR "ioc_config_generate_structs: ioc-config not found (set IOC_CONFIG_CLI)")
+        endif()
+        set(generator ${IOC_CONFIG_CLI})
+        set(generator_depends ${IOC_CONFIG_CLI})
+    endif()
+
+    set(schema_args)
+    if(ARG_SCHEMA)
+        get_filename_component(schema ${ARG_SCHEMA} ABSOLUTE BASE_DIR ${CMAKE_CURRENT_SOURCE_DIR})
+        set(schema_args ${schema})
+        list(APPEND generator_depends ${schema})
+    endif()
+
+    get_filename_component(output ${ARG_OUTPUT} ABSOLUTE BASE_DIR ${CMAKE_CURRENT_BINARY_DIR})
+    get_filename_component(output_dir ${output} DIRECTORY)
+    add_custom_command(
+        OUTPUT ${output}
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${output_dir}
+        COMMAND ${generator} generate-structs ${output} ${ARG_NAMESPACE} ${ARG_STRUCT} ${schema_args}
+        DEPENDS ${generator_depends}
+        COMMENT "Generating typed configuration structs ${ARG_OUTPUT}"
+        VERBATIM)
+endfunction()
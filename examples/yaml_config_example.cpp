@@ -61,8 +61,8 @@ int main() {
     if (parser2.loadFromYaml(yaml_file)) {
         std::cout << "✓ Configuration loaded from: " << yaml_file << "\n";
         std::cout << "  Sections loaded: " << parser2.getSectionCount() << "\n";
-        std::cout << "  Object ID: " << parser2.getParameter("object", ".id") << "\n";
-        std::cout << "  Time Start: " << parser2.getParameter("time", ".start") << "\n\n";
+        std::cout << "  Object ID: " << parser2.getValueByPath("/object/.id") << "\n";
+        std::cout << "  Time Start: " << parser2.getValueByPath("/time/.start") << "\n\n";
     } else {
         std::cout << "✗ Failed to load YAML file\n\n";
     }
@@ -80,8 +80,8 @@ time:
     OopParser parser3;
     if (parser3.loadFromYamlString(yaml_input)) {
         std::cout << "✓ Configuration loaded from YAML string\n";
-        std::cout << "  Object ID: " << parser3.getParameter("object", ".id") << "\n";
-        std::cout << "  Time Start: " << parser3.getParameter("time", ".start") << "\n\n";
+        std::cout << "  Object ID: " << parser3.getValueByPath("/object/.id") << "\n";
+        std::cout << "  Time Start: " << parser3.getValueByPath("/time/.start") << "\n\n";
     } else {
         std::cout << "✗ Failed to load YAML from string\n";
         std::cout << "(YAML support not enabled - this is expected if yaml-cpp is not installed)\n\n";
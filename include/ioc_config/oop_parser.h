@@ -15,16 +15,32 @@
 #define IOC_CONFIG_OOP_PARSER_H
 
 #include <string>
+#include <string_view>
 #include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <deque>
 #include <map>
 #include <memory>
 #include <stdexcept>
 #include <mutex>
+#include <thread>
+#include <atomic>
 #include <functional>
 #include <regex>
+#include <unordered_map>
+#include <unordered_set>
+#include <iterator>
+#include <type_traits>
+#include <list>
+#include <limits>
 #include <sstream>
 #include <nlohmann/json.hpp>
 
+#ifdef IOC_CONFIG_YAML_SUPPORT
+namespace YAML { class Node; }
+#endif
+
 namespace ioc_config {
 
 // Forward declarations
@@ -77,6 +93,9 @@ struct MergeStats {
 
 /**
  * @brief Diff entry for comparing configurations
+ * 
+ * An ADDED or REMOVED entry with an empty key adds or removes the section
+ * itself, so sections without parameters survive a diff/applyDiff round trip.
  */
 struct DiffEntry {
     enum Type { ADDED = 0, REMOVED = 1, MODIFIED = 2, UNCHANGED = 3 };
@@ -90,6 +109,9 @@ struct DiffEntry {
     std::string newType;
 
     std::string toString() const {
+        if (key.empty() && (type == ADDED || type == REMOVED)) {
+            return (type == ADDED ? "[+] " : "[-] ") + section;
+        }
         switch (type) {
             case ADDED: return "[+] " + section + "." + key + " = " + newValue;
             case REMOVED: return "[-] " + section + "." + key + " (was " + oldValue + ")";
@@ -166,17 +188,63 @@ struct RangeConstraint {
 
     /**
      * @brief Parse constraint expression
+     * 
+     * Successful parses are interned in a process-wide cache keyed by the
+     * expression text, so repeated expressions (e.g. "1..100" in every
+     * section of a JSON schema) are parsed once. A successful parse fully
+     * defines the constraint; on failure only constraint_expr is updated.
+     * 
      * @param expr Expression like "1..100", "d >= 4", "5 < d < 30"
      * @return True if parsing successful
      */
     bool parseExpression(const std::string& expr);
 
+    /**
+     * @brief Parse constraint expression without consulting the cache
+     * @param expr Expression like "1..100", "d >= 4", "5 < d < 30"
+     * @return True if parsing successful
+     */
+    bool parseExpressionUncached(const std::string& expr);
+
     /**
      * @brief Check if value satisfies constraint
+     * 
+     * Evaluated without branches, so it vectorizes in loops over values.
+     * NaN never satisfies an enabled constraint.
+     * 
      * @param value Value to check
      * @return True if value is within constraints
      */
-    bool isSatisfied(double value) const;
+    bool isSatisfied(double value) const {
+        bool min_ok = (value > min_value) | ((value == min_value) & min_inclusive);
+        bool max_ok = (value < max_value) | ((value == max_value) & max_inclusive);
+        return (!enabled) | (min_ok & max_ok);
+    }
+
+    /**
+     * @brief Find the values that violate the constraint
+     * 
+     * Compares several values per instruction: AVX when the CPU supports
+     * it, otherwise SSE2 on x86-64, and a scalar loop elsewhere. Results
+     * match isSatisfied() element by element (NaN is a violation).
+     * 
+     * @param values Contiguous values
+     * @param count Number of values
+     * @param violations Output vector; indices of violating values are appended in ascending order
+     * @return Number of violations found
+     */
+    size_t findViolations(const double* values, size_t count, std::vector<size_t>& violations) const;
+
+    /**
+     * @brief Drop all interned constraint expressions
+     */
+    static void clearExpressionCache();
+
+    /**
+     * @brief Get the number of interned constraint expressions
+     * @return Cache entry count
+     */
+    static size_t getExpressionCacheSize();
 
     /**
      * @brief Get constraint as human-readable string
@@ -193,6 +261,7 @@ struct ParameterSpec {
     bool required;                      ///< Is parameter required?
     std::string description;            ///< Parameter description
     std::string default_value;          ///< Default value if optional
+    std::string type;                   ///< Declared type: "string", "int", "float", "bool", "array" (empty = detect)
     RangeConstraint constraint;         ///< Range/value constraints
     std::vector<std::string> allowed_values;  ///< List of allowed values (for enum types)
 
@@ -207,6 +276,19 @@ struct ParameterSpec {
      * @return True if valid
      */
     bool isValid(const std::string& value) const;
+
+    /**
+     * @brief Check every element of an array value against the spec
+     * 
+     * Numeric arrays are parsed into one contiguous buffer and checked with
+     * RangeConstraint::findViolations(). Non-numeric elements violate an
+     * enabled constraint, as in isValid().
+     * 
+     * @param value Array value like "[1.5, 2, 3]" or "1.5, 2, 3"
+     * @param violations Output vector (cleared first); indices of violating elements
+     * @return True if no element violates the spec
+     */
+    bool findArrayViolations(const std::string& value, std::vector<size_t>& violations) const;
 };
 
 /**
@@ -242,6 +324,109 @@ struct SectionSpec {
     }
 };
 
+class CrossConstraintCompiler;
+
+/**
+ * @brief Compiled rule relating parameters of a configuration
+ * 
+ * Grammar (AND/OR/NOT are case-insensitive aliases of &&, ||, !):
+ * @code
+ * expr       := and ('||' and)*
+ * and        := not ('&&' not)*
+ * not        := '!' not | compare
+ * compare    := sum (op sum)?
+ * op         := < | <= | > | >= | == | = | !=
+ * sum        := product (('+' | '-') product)*
+ * product    := unary (('*' | '/') unary)*
+ * unary      := '-' unary | number | section.key | '(' expr ')'
+ * @endcode
+ * 
+ * Keywords only count as such when followed by a character other than a
+ * letter, digit, '_' or '.', so "not_used.x" and "and.x" are references.
+ * 
+ * The expression is compiled once into stack bytecode; evaluate() runs it
+ * over the referenced values without allocating. Example:
+ * @code
+ * CrossConstraint rule("search.max_mag >= search.min_mag + 2");
+ * double values[] = {12.0, 15.5};   // in getReferences() order
+ * bool ok = rule.evaluate(values);
+ * @endcode
+ */
+class CrossConstraint {
+public:
+    /// Referenced parameter as (section, key)
+    using Reference = std::pair<std::string, std::string>;
+
+    /**
+     * @brief Compile an expression
+     * 
+     * Never throws; check isValid() and getError() for syntax errors.
+     * 
+     * @param expression Constraint expression
+     */
+    explicit CrossConstraint(const std::string& expression);
+
+    /**
+     * @brief Get the source expression
+     * @return Expression as given to the constructor
+     */
+    const std::string& getExpression() const;
+
+    /**
+     * @brief Check if the expression compiled
+     * @return True if the constraint can be used
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Get the compilation error
+     * @return Error message or empty string if valid
+     */
+    const std::string& getError() const;
+
+    /**
+     * @brief Get the referenced parameters, each listed once
+     * @return References in first-use order
+     */
+    const std::vector<Reference>& getReferences() const;
+
+    /**
+     * @brief Evaluate the constraint
+     * @param values One value per reference, in getReferences() order
+     * @return True if the constraint holds (false if invalid)
+     */
+    bool evaluate(const double* values) const;
+
+private:
+    friend class CrossConstraintCompiler;
+    friend struct ConfigSchema;
+
+    static constexpr size_t kMaxStack = 32;     ///< Deepest operand stack evaluate() supports
+
+    enum class Op : uint8_t { CONST, REF, NEG, NOT, ADD, SUB, MUL, DIV, LT, LE, GT, GE, EQ, NE, AND, OR };
+
+    /// One bytecode instruction
+    struct Instruction {
+        Op op;
+        double constant = 0.0;      ///< Operand of CONST
+        size_t ref = 0;             ///< Operand of REF (index into references_)
+    };
+
+    std::string expression_;                ///< Source expression
+    std::string error_;                     ///< Compilation error (empty if valid)
+    std::vector<Reference> references_;     ///< Referenced parameters
+    std::vector<Instruction> code_;         ///< Postfix bytecode
+
+    /**
+     * @brief Recognize "ref op number" (either side) as a single-parameter bound
+     * @param ref Referenced parameter index
+     * @param op Comparison with the reference on the left
+     * @param bound Constant side
+     * @return True if the constraint has that shape
+     */
+    bool asBound(size_t& ref, Op& op, double& bound) const;
+};
+
 /**
  * @brief Configuration schema for validation
  */
@@ -249,6 +434,7 @@ struct ConfigSchema {
     std::string name;                           ///< Schema name
     std::string version;                        ///< Schema version
     std::map<std::string, SectionSpec> sections;  ///< Section specifications
+    std::vector<CrossConstraint> constraints;   ///< Rules across parameters
 
     /**
      * @brief Add section specification
@@ -258,6 +444,28 @@ struct ConfigSchema {
         sections[spec.name] = spec;
     }
 
+    /**
+     * @brief Add a cross-parameter constraint
+     * 
+     * Rules referencing a parameter that is absent from the configuration
+     * are skipped (use required parameters to enforce presence). Values are
+     * read as numbers, or as ISO 8601 dates (YYYY-MM-DD, optionally with
+     * THH:MM[:SS], quotes allowed) converted to Modified Julian Date so
+     * dates compare with each other and with MJD numbers; rules
+     * referencing any other value fail.
+     * 
+     * @param expression Expression like "time.end > time.start"
+     * @return False (and nothing added) if the expression does not compile
+     */
+    bool addConstraint(const std::string& expression) {
+        CrossConstraint constraint(expression);
+        if (!constraint.isValid()) {
+            return false;
+        }
+        constraints.push_back(std::move(constraint));
+        return true;
+    }
+
     /**
      * @brief Get section specification
      * @param name Section name
@@ -270,6 +478,11 @@ struct ConfigSchema {
 
     /**
      * @brief Export schema to JSON Schema format
+     * 
+     * Cross-parameter constraints are listed under "constraints"; those
+     * comparing one parameter with a number also become its minimum or
+     * maximum keywords.
+     * 
      * @return JSON Schema as nlohmann::json object
      */
     nlohmann::json toJsonSchema() const;
@@ -287,6 +500,265 @@ struct ConfigSchema {
      * @return JSON Schema as string
      */
     std::string toJsonSchemaString(int indent = 2) const;
+
+    /**
+     * @brief Replace this schema with one read from JSON Schema
+     * 
+     * Reads what toJsonSchema() writes: sections and parameters from
+     * "properties" and "required", descriptions, "default", "enum",
+     * "constraint" (or the minimum/maximum keywords) and "constraints".
+     * JSON types map back to ParameterSpec::type (integer -> int,
+     * number -> float, boolean -> bool, array); "string" leaves it empty,
+     * since toJsonSchema() also writes it for undeclared types.
+     * 
+     * @param schema JSON Schema document
+     * @return False (schema unchanged) if it has no "properties" object or
+     *         a constraint does not compile
+     */
+    bool fromJsonSchema(const nlohmann::json& schema);
+
+    /**
+     * @brief Load schema from a JSON Schema file
+     * @param filepath Path to JSON Schema file (e.g. written by saveJsonSchema())
+     * @return True if successful
+     */
+    bool loadJsonSchema(const std::string& filepath);
+
+    /**
+     * @brief Generate a C++ header with typed structs and a loader
+     * 
+     * Emits one struct per section and an aggregate struct holding them,
+     * plus an inline load<structName>() that fills it from an OopParser in
+     * one pass, so hot paths read struct fields instead of looking up keys.
+     * Fields take their C++ type from ParameterSpec::type (int, float ->
+     * double, bool; string and array -> std::string); untyped parameters
+     * with a range constraint become double, the rest std::string.
+     * default_value initialises the field.
+     * 
+     * @param namespaceName Namespace of the generated code
+     * @param structName Name of the aggregate struct
+     * @return Header source
+     */
+    std::string toCppHeader(const std::string& namespaceName = "ioc_config_generated",
+                            const std::string& structName = "Config") const;
+
+    /**
+     * @brief Write the header generated by toCppHeader() to a file
+     * @param filepath Path to output header
+     * @param namespaceName Namespace of the generated code
+     * @param structName Name of the aggregate struct
+     * @return True if successful
+     */
+    bool saveCppHeader(const std::string& filepath,
+                       const std::string& namespaceName = "ioc_config_generated",
+                       const std::string& structName = "Config") const;
+};
+
+/**
+ * @brief One problem found by OopParser::validateFull()
+ * 
+ * Records carry the names involved rather than a formatted message;
+ * toString() builds the message on demand.
+ */
+struct ValidationIssue {
+    /**
+     * @brief Kind of problem
+     */
+    enum class Kind {
+        MISSING_SECTION,        ///< Required section absent
+        MISSING_PARAMETER,      ///< Required parameter absent from a present section
+        INVALID_VALUE,          ///< Value violates allowed values or range
+        UNKNOWN_SECTION,        ///< Section not described by the schema
+        UNKNOWN_PARAMETER,      ///< Parameter not described by its section spec
+        CONSTRAINT_VIOLATED     ///< Cross-parameter constraint does not hold (section/key empty)
+    };
+
+    Kind kind;                      ///< Problem kind
+    std::string section;            ///< Section name
+    std::string key;                ///< Parameter key (empty for section issues)
+    std::string value;              ///< Offending value (INVALID_VALUE only)
+    std::string constraint;         ///< Violated constraint or expression text (INVALID_VALUE, CONSTRAINT_VIOLATED)
+
+    /**
+     * @brief Format the issue as a message
+     * @return Human-readable description
+     */
+    std::string toString() const;
+};
+
+/**
+ * @brief ConfigSchema flattened into a validation plan
+ * 
+ * Compile once and reuse for many configurations: sections and parameters
+ * are stored in flat vectors, allowed values in hash sets and numeric
+ * bounds pre-decoded, and values are parsed without exceptions. The plan
+ * is immutable, so one instance can validate on several threads at once.
+ * 
+ * @code
+ * CompiledSchema compiled(OopParser::createDefaultSchema());
+ * for (const auto& config : configs) {
+ *     config.validateWithSchema(compiled, errors);
+ * }
+ * @endcode
+ */
+class CompiledSchema {
+public:
+    /**
+     * @brief Compile a schema
+     * @param schema Schema to compile
+     */
+    explicit CompiledSchema(const ConfigSchema& schema);
+
+    /**
+     * @brief Get the schema name
+     * @return Name of the compiled schema
+     */
+    const std::string& getName() const;
+
+    /**
+     * @brief Check a value against one parameter of the plan
+     * 
+     * Same rules as ParameterSpec::isValid(): allowed values if any, else
+     * the range for numeric values; non-numeric values pass only when the
+     * parameter has no range.
+     * 
+     * @param section Section name
+     * @param key Parameter key
+     * @param value Value to check
+     * @return True if valid (or the parameter is not in the schema)
+     */
+    bool isValueValid(const std::string& section, const std::string& key, const std::string& value) const;
+
+private:
+    friend class OopParser;
+
+    /// Flattened ParameterSpec
+    struct ParameterRule {
+        std::string key;                                ///< Parameter key
+        bool required = false;                          ///< Must be present
+        bool hasAllowedValues = false;                  ///< Value must be one of allowedValues
+        std::unordered_set<std::string> allowedValues;  ///< Allowed values
+        bool hasRange = false;                          ///< Numeric range is active
+        double minValue = 0.0;                          ///< Lower bound
+        double maxValue = 0.0;                          ///< Upper bound
+        bool minInclusive = true;                       ///< Lower bound inclusive
+        bool maxInclusive = true;                       ///< Upper bound inclusive
+        std::string constraintText;                     ///< Constraint for error messages
+        std::string type;                               ///< Declared type (empty = detect)
+        std::string defaultValue;                       ///< Value filled in when an optional parameter is missing
+
+        bool check(const std::string& value) const;
+    };
+
+    /// Flattened SectionSpec
+    struct SectionRule {
+        std::string name;                               ///< Section name
+        bool required = false;                          ///< Must be present
+        std::vector<ParameterRule> params;              ///< Parameters in key order
+        std::unordered_map<std::string, size_t> paramIndex;  ///< Key to params index
+    };
+
+    std::string name_;                                  ///< Schema name
+    std::vector<SectionRule> sections_;                 ///< Sections in name order
+    std::unordered_map<std::string, size_t> sectionIndex_;  ///< Name to sections_ index
+    std::vector<CrossConstraint> constraints_;          ///< Cross-parameter rules
+};
+
+/**
+ * @brief JSON Schema compiled for validating parser contents
+ * 
+ * Supports the draft-07 keywords type, enum, minimum, maximum,
+ * exclusiveMinimum, exclusiveMaximum, required, properties and
+ * additionalProperties, plus boolean schemas; other keywords are ignored.
+ * The root schema describes the configuration (sections are its
+ * properties), section schemas describe sections (parameters are their
+ * properties). A top-level "constraints" array, as written by
+ * ConfigSchema::toJsonSchema(), is compiled into CrossConstraints.
+ * 
+ * Parameters are typed as in OopParser::toJson(): numeric values are
+ * numbers (integers when integral), bool and array parameters are booleans
+ * and arrays, anything else is a string. Since OOP values are text, every
+ * parameter also satisfies "string" and string enum entries match the
+ * unquoted value text; this keeps schemas written by
+ * ConfigSchema::toJsonSchema() (which types unconstrained parameters as
+ * strings) usable.
+ * 
+ * @code
+ * CompiledJsonSchema compiled(schemaJson);
+ * for (const auto& config : configs) {
+ *     config.validateAgainstSchema(compiled, errors);
+ * }
+ * @endcode
+ */
+class CompiledJsonSchema {
+public:
+    /**
+     * @brief Compile a JSON Schema
+     * 
+     * Never throws; check isValid() and getError() for malformed schemas.
+     * 
+     * @param schema JSON Schema document
+     */
+    explicit CompiledJsonSchema(const nlohmann::json& schema);
+
+    /**
+     * @brief Check if the schema compiled
+     * @return True if the schema can be used
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Get the compilation error
+     * @return Error message or empty string if valid
+     */
+    const std::string& getError() const;
+
+private:
+    friend class OopParser;
+
+    /// JSON types accepted by a node, as bits
+    enum TypeBits : uint8_t {
+        TYPE_OBJECT = 1, TYPE_ARRAY = 2, TYPE_STRING = 4, TYPE_NUMBER = 8,
+        TYPE_INTEGER = 16, TYPE_BOOLEAN = 32, TYPE_NULL = 64
+    };
+
+    /// One compiled (sub)schema
+    struct Node {
+        bool rejectAll = false;                         ///< Boolean schema false
+        uint8_t types = 0;                              ///< Accepted TypeBits (0 = any)
+        bool hasEnum = false;                           ///< enum present
+        std::vector<nlohmann::json> enumValues;         ///< Allowed values
+        double minimum = -std::numeric_limits<double>::infinity();           ///< Inclusive lower bound
+        double maximum = std::numeric_limits<double>::infinity();            ///< Inclusive upper bound
+        double exclusiveMinimum = -std::numeric_limits<double>::infinity();  ///< Exclusive lower bound
+        double exclusiveMaximum = std::numeric_limits<double>::infinity();   ///< Exclusive upper bound
+        std::vector<std::string> required;              ///< Required property names
+        std::unordered_map<std::string, size_t> properties;  ///< Property name to node index
+        bool additionalAllowed = true;                  ///< additionalProperties is not false
+        size_t additionalSchema = std::string::npos;    ///< Node for additional properties (npos = none)
+    };
+
+    std::string error_;                         ///< Compilation error (empty if valid)
+    std::vector<Node> nodes_;                   ///< Compiled nodes, root first
+    std::vector<CrossConstraint> constraints_;  ///< Rules from the "constraints" extension
+
+    /**
+     * @brief Compile one (sub)schema into nodes_
+     * @param schema Schema object or boolean
+     * @param path Location in the schema document (for errors)
+     * @return Node index, or npos on error (error_ set)
+     */
+    size_t compileNode(const nlohmann::json& schema, const std::string& path);
+
+    /**
+     * @brief Check the type, enum and bounds of a parameter value
+     * @param node Node to check against
+     * @param section Name of the section holding the parameter (for errors)
+     * @param param Parameter
+     * @param errors Output vector (errors are appended)
+     */
+    static void checkValue(const Node& node, const std::string& section, const ConfigParameter& param,
+                           std::vector<std::string>& errors);
 };
 
 /**
@@ -314,7 +786,7 @@ enum class SectionType {
 struct ConfigSectionData {
     SectionType type;                                    ///< Section type enumeration
     std::string name;                                    ///< Section name (e.g., "object", "propag")
-    std::map<std::string, ConfigParameter> parameters;   ///< Map of parameters in this section
+    std::map<std::string, ConfigParameter, std::less<>> parameters;   ///< Map of parameters in this section (heterogeneous lookup)
 
     /**
      * @brief Convert section type to string
@@ -339,115 +811,471 @@ struct ConfigSectionData {
     const ConfigParameter* getParameter(const std::string& key) const;
 };
 
+class OopParser;
+
 /**
- * @brief Main OOP File Parser class
+ * @brief Pre-parsed JSON Pointer path for repeated access
  * 
- * This class handles parsing and manipulation of OOP (OrbFit-style) 
- * configuration files used by IOccultCalc.
+ * The path is split and unescaped once. Each parser remembers which of
+ * its sections the handle resolves to until its layout changes (sections
+ * added, removed or copied on write), so repeated reads skip parsing and
+ * the section scan and only look the key up in that section. The cache
+ * lives in the parser, so one handle can be used with many parsers and
+ * from several threads.
+ * 
+ * @code
+ * const PathHandle mag("/object/.magnitude");
+ * for (auto& parser : asteroids) {
+ *     std::string value = parser.getValueByPath(mag);
+ * }
+ * @endcode
  */
-class OopParser {
+class PathHandle {
 public:
     /**
-     * @brief Default constructor
+     * @brief Construct handle for the root path
      */
-    OopParser();
+    PathHandle();
 
     /**
-     * @brief Constructor with file path
-     * @param filepath Path to the OOP configuration file
+     * @brief Parse a JSON Pointer path
+     * @param path JSON Pointer path (e.g. "/object/id")
      */
-    explicit OopParser(const std::string& filepath);
+    explicit PathHandle(const std::string& path);
 
     /**
-     * @brief Destructor
+     * @brief Get the original path string
+     * @return Path as given to the constructor
      */
-    ~OopParser() = default;
+    const std::string& getPath() const;
 
     /**
-     * @brief Move constructor (disabled due to mutex)
+     * @brief Get unescaped path components
+     * @return Components (empty for root)
      */
-    OopParser(OopParser&&) = delete;
+    const std::vector<std::string>& getComponents() const;
 
     /**
-     * @brief Move assignment operator (disabled due to mutex)
+     * @brief Check if the path addresses a parameter (section and key)
+     * @return True for "/section/key" paths
      */
-    OopParser& operator=(OopParser&&) = delete;
+    bool isParameterPath() const;
 
-    // Disable copy semantics
-    OopParser(const OopParser&) = delete;
-    OopParser& operator=(const OopParser&) = delete;
+private:
+    friend class OopParser;
+
+    std::string path_;                          ///< Original path
+    std::vector<std::string> components_;       ///< Unescaped components
+    uint64_t id_;                               ///< Key of the handle in parsers' path caches (kept by copies)
+};
+
+/**
+ * @brief Per-path outcome of a batched path operation
+ */
+enum class PathStatus {
+    OK,             ///< Parameter read or updated
+    CREATED,        ///< Parameter (and possibly its section) was created
+    NOT_FOUND,      ///< Section or parameter does not exist
+    INVALID_PATH    ///< Path is not a "/section/key" parameter path
+};
+
+/**
+ * @brief Result of one path in getValuesByPaths()
+ */
+struct PathResult {
+    PathStatus status = PathStatus::NOT_FOUND;  ///< Lookup outcome
+    std::string value;                          ///< Parameter value (when status is OK)
+};
 
+/**
+ * @brief Regular expression compiled once for repeated key/value searches
+ * 
+ * Matching is case-insensitive and uses search semantics (the pattern may
+ * match anywhere in the text), as getParametersByKeyPattern() does.
+ * Instances are immutable after construction, so one pattern can be
+ * shared between threads.
+ * 
+ * Common shapes skip std::regex entirely: plain text, "^prefix",
+ * "suffix$", "^exact$" and literals joined by ".*" are matched with
+ * direct string comparisons. Anything else falls back to std::regex.
+ */
+class CompiledPattern {
+public:
     /**
-     * @brief Load configuration from OOP file
-     * @param filepath Path to the OOP configuration file
-     * @return True if successful, false otherwise
+     * @brief Matching strategy chosen for a pattern
      */
-    bool loadFromOop(const std::string& filepath);
+    enum class Kind {
+        LITERAL,    ///< Substring anywhere ("steroid")
+        PREFIX,     ///< Anchored at start ("^obj")
+        SUFFIX,     ///< Anchored at end ("tude$")
+        EXACT,      ///< Whole text ("^name$")
+        GLOB,       ///< Literals separated by ".*" ("^obj.*mag")
+        REGEX       ///< Full std::regex
+    };
 
     /**
-     * @brief Save configuration to OOP file
-     * @param filepath Path where to save the OOP configuration file
-     * @return True if successful, false otherwise
+     * @brief Compile a pattern
+     * 
+     * Never throws; check isValid() and getError() for syntax errors.
+     * 
+     * @param pattern Regular expression
      */
-    bool saveToOop(const std::string& filepath) const;
+    explicit CompiledPattern(const std::string& pattern);
 
     /**
-     * @brief Load configuration from JSON file
-     * @param filepath Path to the JSON configuration file
-     * @return True if successful, false otherwise
+     * @brief Get the source pattern
+     * @return Pattern as given to the constructor
      */
-    bool loadFromJson(const std::string& filepath);
+    const std::string& getPattern() const;
 
     /**
-     * @brief Save configuration to JSON file
-     * @param filepath Path where to save the JSON configuration file
-     * @return True if successful, false otherwise
+     * @brief Check if the pattern compiled
+     * @return True if the pattern can be used
      */
-    bool saveToJson(const std::string& filepath) const;
+    bool isValid() const;
 
     /**
-     * @brief Get all sections
-     * @return Vector of ConfigSectionData structures
+     * @brief Get the compilation error
+     * @return Error message or empty string if valid
      */
-    std::vector<ConfigSectionData> getAllSections() const;
+    const std::string& getError() const;
 
     /**
-     * @brief Get section by type
-     * @param type Section type
-     * @return Pointer to section or nullptr if not found
+     * @brief Search the pattern in a text
+     * @param text Text to search
+     * @return True if the pattern matches somewhere (false if invalid)
      */
-    ConfigSectionData* getSection(SectionType type);
-    const ConfigSectionData* getSection(SectionType type) const;
+    bool matches(std::string_view text) const;
 
     /**
-     * @brief Get section by name
-     * @param name Section name (e.g., "object", "propag")
-     * @return Pointer to section or nullptr if not found
+     * @brief Get the matching strategy
+     * @return Kind selected when the pattern was compiled
      */
-    ConfigSectionData* getSection(const std::string& name);
-    const ConfigSectionData* getSection(const std::string& name) const;
+    Kind getKind() const;
+
+private:
+    std::string pattern_;               ///< Source pattern
+    std::string error_;                 ///< Compilation error (empty if valid)
+    Kind kind_;                         ///< Matching strategy
+    std::vector<std::string> segments_; ///< Lower-cased literals (non-REGEX kinds)
+    bool anchorStart_;                  ///< First segment must start the text
+    bool anchorEnd_;                    ///< Last segment must end the text
+    std::regex regex_;                  ///< Compiled expression (GLOB and REGEX)
 
     /**
-     * @brief Add or update a parameter in a section
-     * @param sectionName Name of the section
-     * @param paramKey Parameter key (with or without leading dot)
-     * @param value Parameter value
-     * @return True if successful, false otherwise
+     * @brief Try to express the pattern as literal segments
+     * @return True if a fast kind was selected
      */
-    bool setParameter(const std::string& sectionName, 
-                      const std::string& paramKey, 
-                      const std::string& value);
+    bool analyze();
+};
+
+class ConfigQueryParser;
 
+/**
+ * @brief Compiled parameter filter expression
+ * 
+ * Grammar (keywords and field names are case-insensitive):
+ * @code
+ * expr       := term (OR term)*
+ * term       := factor (AND factor)*
+ * factor     := NOT factor | '(' expr ')' | field op literal
+ * field      := section | key | value | type
+ * op         := = | != | < | <= | > | >= | ~
+ * @endcode
+ * 
+ * Literals are bare words or quoted with ' or ". On value, = and != compare
+ * numerically when both sides are numbers, and the ordering operators
+ * only match numeric values. "~" searches a CompiledPattern. Example:
+ * @code
+ * ConfigQuery query("section=propag AND type=float AND value>1e-10");
+ * @endcode
+ * 
+ * Conditions "section=..." and "type=..." joined by top-level ANDs let
+ * OopParser::queryParameters() visit only those sections and use the type
+ * index instead of scanning every parameter.
+ */
+class ConfigQuery {
+public:
     /**
-     * @brief Find parameter by key across all sections
-     * @param paramKey Parameter key to search for
-     * @return Pointer to first matching parameter or nullptr
+     * @brief Compile an expression
+     * 
+     * Never throws; check isValid() and getError() for syntax errors.
+     * 
+     * @param expression Query expression
      */
-    ConfigParameter* findParameter(const std::string& paramKey);
-    const ConfigParameter* findParameter(const std::string& paramKey) const;
+    explicit ConfigQuery(const std::string& expression);
 
     /**
-     * @brief Validate configuration
+     * @brief Get the source expression
+     * @return Expression as given to the constructor
+     */
+    const std::string& getExpression() const;
+
+    /**
+     * @brief Check if the expression compiled
+     * @return True if the query can be used
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Get the compilation error
+     * @return Error message or empty string if valid
+     */
+    const std::string& getError() const;
+
+    /**
+     * @brief Evaluate the expression for one parameter
+     * @param section Section holding the parameter
+     * @param param Parameter to test
+     * @return True if the parameter matches (false if invalid)
+     */
+    bool matches(const ConfigSectionData& section, const ConfigParameter& param) const;
+
+private:
+    friend class OopParser;
+    friend class ConfigQueryParser;
+
+    enum class Field { SECTION, KEY, VALUE, TYPE };
+    enum class Op { EQ, NE, LT, LE, GT, GE, MATCH };
+
+    /// Expression tree node; children are indexes into nodes_
+    struct Node {
+        enum class Kind { AND, OR, NOT, COMPARE } kind;
+        size_t left = 0;                                ///< First operand
+        size_t right = 0;                               ///< Second operand (AND/OR)
+        Field field = Field::VALUE;                     ///< Compared field
+        Op op = Op::EQ;                                 ///< Comparison operator
+        std::string literal;                            ///< Literal text
+        double number = 0.0;                            ///< Literal as number
+        bool isNumber = false;                          ///< Literal parsed as number
+        std::shared_ptr<const CompiledPattern> pattern; ///< Pattern for "~"
+    };
+
+    std::string expression_;                ///< Source expression
+    std::string error_;                     ///< Compilation error (empty if valid)
+    std::vector<Node> nodes_;               ///< Expression tree
+    size_t root_;                           ///< Root node index
+    bool hasSectionFilter_;                 ///< Top-level AND restricts sections
+    std::vector<std::string> sections_;     ///< Allowed section names (when filtered)
+    std::string typeFilter_;                ///< Required type from top-level AND (empty = any)
+    bool impossible_;                       ///< Top-level ANDs contradict each other
+
+    bool evaluate(size_t node, const ConfigSectionData& section, const ConfigParameter& param) const;
+    void planIndexes();
+};
+
+/**
+ * @brief Read-only range over a parser's sections, held under its lock
+ * 
+ * Obtained from OopParser::viewSections(). The parser stays locked while
+ * the view is alive, so keep views short-lived and do not call back into
+ * the parser (or another thread's writer) while holding one.
+ * 
+ * @code
+ * for (const ConfigSectionData& section : parser.viewSections()) {
+ *     std::cout << section.name << "\n";
+ * }
+ * @endcode
+ */
+class SectionsView {
+public:
+    using SectionList = std::vector<std::shared_ptr<ConfigSectionData>>;
+
+    /**
+     * @brief Forward iterator yielding const section references
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ConfigSectionData;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const ConfigSectionData*;
+        using reference = const ConfigSectionData&;
+
+        explicit const_iterator(SectionList::const_iterator it) : it_(it) {}
+
+        reference operator*() const { return **it_; }
+        pointer operator->() const { return it_->get(); }
+        const_iterator& operator++() { ++it_; return *this; }
+        const_iterator operator++(int) { const_iterator copy = *this; ++it_; return copy; }
+        bool operator==(const const_iterator& other) const { return it_ == other.it_; }
+        bool operator!=(const const_iterator& other) const { return it_ != other.it_; }
+
+    private:
+        SectionList::const_iterator it_;
+    };
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    /**
+     * @brief Get number of sections
+     * @return Section count
+     */
+    size_t size() const;
+
+    /**
+     * @brief Check if there are no sections
+     * @return True if empty
+     */
+    bool empty() const;
+
+    /**
+     * @brief Access a section by position
+     * @param index Section index (must be < size())
+     * @return Section reference
+     */
+    const ConfigSectionData& operator[](size_t index) const;
+
+private:
+    friend class OopParser;
+
+    SectionsView(std::unique_lock<std::mutex> lock, const SectionList& sections);
+
+    std::unique_lock<std::mutex> lock_;     ///< Parser lock held by the view
+    const SectionList* sections_;           ///< Viewed sections
+};
+
+/**
+ * @brief Main OOP File Parser class
+ * 
+ * This class handles parsing and manipulation of OOP (OrbFit-style) 
+ * configuration files used by IOccultCalc.
+ */
+class OopParser {
+public:
+    /**
+     * @brief Default constructor
+     */
+    OopParser();
+
+    /**
+     * @brief Constructor with file path
+     * @param filepath Path to the OOP configuration file
+     */
+    explicit OopParser(const std::string& filepath);
+
+    /**
+     * @brief Destructor
+     */
+    ~OopParser() = default;
+
+    /**
+     * @brief Move constructor (disabled due to mutex)
+     */
+    OopParser(OopParser&&) = delete;
+
+    /**
+     * @brief Move assignment operator (disabled due to mutex)
+     */
+    OopParser& operator=(OopParser&&) = delete;
+
+    // Disable copy semantics
+    OopParser(const OopParser&) = delete;
+    OopParser& operator=(const OopParser&) = delete;
+
+    /**
+     * @brief Load configuration from OOP file
+     * @param filepath Path to the OOP configuration file
+     * @return True if successful, false otherwise
+     */
+    bool loadFromOop(const std::string& filepath);
+
+    /**
+     * @brief Save configuration to OOP file
+     * @param filepath Path where to save the OOP configuration file
+     * @return True if successful, false otherwise
+     */
+    bool saveToOop(const std::string& filepath) const;
+
+    /**
+     * @brief Load configuration from JSON file
+     * @param filepath Path to the JSON configuration file
+     * @return True if successful, false otherwise
+     */
+    bool loadFromJson(const std::string& filepath);
+
+    /**
+     * @brief Save configuration to JSON file
+     * @param filepath Path where to save the JSON configuration file
+     * @return True if successful, false otherwise
+     */
+    bool saveToJson(const std::string& filepath) const;
+
+    /**
+     * @brief Get all sections
+     * @return Vector of ConfigSectionData structures
+     */
+    std::vector<ConfigSectionData> getAllSections() const;
+
+    /**
+     * @brief Visit every section without copying
+     * 
+     * The visitor runs with the parser locked and must not call back into it.
+     * 
+     * @param visitor Receives each section in order
+     */
+    void forEachSection(const std::function<void(const ConfigSectionData&)>& visitor) const;
+
+    /**
+     * @brief Get a locked, non-copying range over all sections
+     * @return View holding the parser lock until destroyed
+     */
+    SectionsView viewSections() const;
+
+    /**
+     * @brief Get section by type
+     * 
+     * The non-const overload follows the same copy-on-write rules as
+     * getSection(const std::string&).
+     * 
+     * @param type Section type
+     * @return Pointer to section or nullptr if not found
+     */
+    ConfigSectionData* getSection(SectionType type);
+    const ConfigSectionData* getSection(SectionType type) const;
+
+    /**
+     * @brief Get section by name
+     * 
+     * The non-const overload unshares the section, and later clone(),
+     * copyFrom() and createVersion() give the copy its own copy of that
+     * section instead of sharing it, so writes through the returned pointer
+     * never reach clones or version snapshots. The pointer stays valid
+     * until the section is removed or the parser is cleared, reloaded or
+     * copied into.
+     * 
+     * @param name Section name (e.g., "object", "propag")
+     * @return Pointer to section or nullptr if not found
+     */
+    ConfigSectionData* getSection(const std::string& name);
+    const ConfigSectionData* getSection(const std::string& name) const;
+
+    /**
+     * @brief Add or update a parameter in a section
+     * @param sectionName Name of the section
+     * @param paramKey Parameter key (with or without leading dot)
+     * @param value Parameter value
+     * @return True if successful, false otherwise
+     */
+    bool setParameter(const std::string& sectionName, 
+                      const std::string& paramKey, 
+                      const std::string& value);
+
+    /**
+     * @brief Find parameter by key across all sections
+     * 
+     * The non-const overload unshares the containing section like
+     * getSection(), so writes through the pointer stay local to this parser.
+     * 
+     * @param paramKey Parameter key to search for
+     * @return Pointer to first matching parameter or nullptr
+     */
+    ConfigParameter* findParameter(const std::string& paramKey);
+    const ConfigParameter* findParameter(const std::string& paramKey) const;
+
+    /**
+     * @brief Validate configuration
      * @param errors Output vector to collect validation errors
      * @return True if valid, false otherwise
      */
@@ -462,12 +1290,96 @@ public:
     bool validateWithSchema(const ConfigSchema& schema, 
                            std::vector<std::string>& errors) const;
 
+    /**
+     * @brief Validate configuration against a compiled schema
+     * 
+     * Checks the same rules and reports the same messages, in the same
+     * order, as validateWithSchema(const ConfigSchema&, ...).
+     * 
+     * @param schema Compiled schema
+     * @param errors Output vector to collect validation errors
+     * @return True if valid according to schema
+     */
+    bool validateWithSchema(const CompiledSchema& schema,
+                           std::vector<std::string>& errors) const;
+
+    /**
+     * @brief Validate every section and parameter against a compiled schema
+     * 
+     * Unlike validateWithSchema(), optional sections and parameters that
+     * are present are checked too, and sections or keys the schema does
+     * not describe are reported. Each section's parameters are walked once
+     * alongside the schema's (both are sorted by key). Issues are appended
+     * in configuration order, followed by missing required sections.
+     * 
+     * @param schema Compiled schema
+     * @param issues Output vector (cleared first; reuse it to keep its capacity)
+     * @return True if no issues were found
+     */
+    bool validateFull(const CompiledSchema& schema, std::vector<ValidationIssue>& issues) const;
+
+    /**
+     * @brief Revalidate against the attached schema, re-checking only what changed
+     * 
+     * Keeps the validateFull() results of every section and, on each call,
+     * re-checks only sections modified since the previous call (edits mark
+     * them through the same copy-on-write path as the type index). When
+     * sections were only edited, the cost is proportional to the edited
+     * sections; adding or removing sections costs one pass over the section
+     * pointers.
+     * 
+     * Without an attached schema (setSchema()) the configuration is
+     * considered valid.
+     * 
+     * @return True if the configuration currently has no issues
+     */
+    bool revalidate() const;
+
+    /**
+     * @brief Revalidate and return the cumulative issues
+     * @param issues Output vector (cleared first), in the same order as validateFull()
+     * @return True if the configuration currently has no issues
+     */
+    bool revalidate(std::vector<ValidationIssue>& issues) const;
+
     /**
      * @brief Set schema for validation
+     * 
+     * Also compiles the schema for revalidate() and discards its cached results.
+     * 
      * @param schema Schema to use for validation
      */
     void setSchema(const ConfigSchema& schema);
 
+    /**
+     * @brief Enable schema-typed loading for loadFromOop() and loadFromJson*()
+     * 
+     * With a schema attached, parameters the schema declares a type for are
+     * checked once at load against that type and take it as
+     * ConfigParameter::type without calling detectType(). Parameters the
+     * schema does not type, and values that do not parse as their declared
+     * type, keep the detected type.
+     * 
+     * Missing optional parameters with a default_value are added in the
+     * same pass, including those of optional sections absent from the
+     * source (the section is created). Missing required sections are not
+     * created.
+     * 
+     * Values are not decoded into typed storage: ConfigParameter keeps
+     * only the text, and asDouble()/asInt()/asBoolean() parse it on each
+     * call. For typed fields decoded once, use the structs generated by
+     * ConfigSchema::toCppHeader().
+     * 
+     * @param enabled True to enable
+     */
+    void setSchemaTypedLoading(bool enabled);
+
+    /**
+     * @brief Check if schema-typed loading is enabled
+     * @return True if enabled
+     */
+    bool isSchemaTypedLoading() const;
+
     /**
      * @brief Get current schema
      * @return Pointer to current schema or nullptr
@@ -491,6 +1403,12 @@ public:
      */
     size_t getSectionCount() const;
 
+    /**
+     * @brief Get total number of parameters across all sections
+     * @return Number of parameters
+     */
+    size_t getParameterCount() const;
+
     /**
      * @brief Get last error message
      * @return Error message string
@@ -797,6 +1715,10 @@ public:
 
     /**
      * @brief Validate configuration against JSON schema
+     * 
+     * Compiles the schema on every call; keep a CompiledJsonSchema to
+     * validate many configurations.
+     * 
      * @param schemaJson Optional JSON schema for validation
      * @param errors Output vector to collect validation errors
      * @return True if valid against schema
@@ -804,6 +1726,20 @@ public:
     bool validateAgainstSchema(const nlohmann::json& schemaJson, 
                                std::vector<std::string>& errors) const;
 
+    /**
+     * @brief Validate configuration against a compiled JSON schema
+     * 
+     * Walks sections and parameters directly, without converting the
+     * configuration to JSON. Errors are prefixed with the JSON Pointer of
+     * the offending location (e.g. "/search/max_magnitude: ...").
+     * 
+     * @param schema Compiled JSON schema
+     * @param errors Output vector to collect validation errors
+     * @return True if valid against schema
+     */
+    bool validateAgainstSchema(const CompiledJsonSchema& schema,
+                               std::vector<std::string>& errors) const;
+
     /**
      * @brief Get configuration as formatted JSON string (pretty-printed)
      * @param indent Number of spaces for indentation (default: 2)
@@ -839,6 +1775,19 @@ public:
      */
     static std::vector<std::string> split(const std::string& str, char delimiter);
 
+    /**
+     * @brief Parse a comma-separated numeric array into doubles (static utility)
+     * 
+     * Parses in place without splitting into substrings; enclosing brackets
+     * are optional and Fortran D exponents are accepted. Elements that are
+     * not numbers are stored as NaN.
+     * 
+     * @param value Array value like "[1.5, 2, 3]"
+     * @param out Output buffer (cleared first), one double per element
+     * @return True if every element was numeric
+     */
+    static bool parseNumericArray(const std::string& value, std::vector<double>& out);
+
     /**
      * @brief Detect data type of a value (static utility)
      * @param value Value string
@@ -893,16 +1842,37 @@ public:
      */
     nlohmann::json diffAsJson(const OopParser& other) const;
 
+    /**
+     * @brief Apply a change set produced by diff()
+     * 
+     * ADDED and MODIFIED entries set the parameter to newValue/newType,
+     * REMOVED entries delete it. Entries with an empty key add or remove
+     * the whole section; a section emptied by parameter removals is kept.
+     * UNCHANGED entries are ignored, so `a.applyDiff(a.diff(b))` turns
+     * `a` into `b`.
+     * 
+     * @param changes Diff entries to apply, in order
+     * @return True if successful
+     */
+    bool applyDiff(const std::vector<DiffEntry>& changes);
+
     // ============ Cloning & Copying ============
 
     /**
-     * @brief Create a deep copy of this parser
+     * @brief Create a copy of this parser
+     * 
+     * Sections are shared with the original and copied on first write,
+     * so cloning costs O(sections) rather than O(parameters).
+     * 
      * @return Unique pointer to cloned parser
      */
     std::unique_ptr<OopParser> clone() const;
 
     /**
      * @brief Copy configuration from another parser
+     * 
+     * Like clone(), sections are shared copy-on-write with the source.
+     * 
      * @param other Source parser to copy from
      * @return Reference to this parser for chaining
      */
@@ -914,6 +1884,12 @@ public:
      */
     bool isEmpty() const;
 
+    /**
+     * @brief Estimate heap memory held by sections and parameters
+     * @return Approximate size in bytes
+     */
+    size_t getMemoryUsage() const;
+
     // ============ Query & Filter Operations ============
 
     /**
@@ -932,14 +1908,100 @@ public:
     std::vector<ConfigSectionData> getSectionsWhere(
         std::function<bool(const ConfigSectionData&)> predicate) const;
 
+    /**
+     * @brief Visit parameters matching a predicate without copying
+     * 
+     * Predicate and visitor run with the parser locked and must not call
+     * back into it.
+     * 
+     * @param predicate Function that returns true for matching parameters
+     * @param visitor Receives the section and each matching parameter
+     * @return Number of matching parameters
+     */
+    size_t forEachParameterWhere(
+        const std::function<bool(const ConfigParameter&)>& predicate,
+        const std::function<void(const ConfigSectionData&, const ConfigParameter&)>& visitor) const;
+
+    /**
+     * @brief Visit sections matching a predicate without copying
+     * 
+     * Predicate and visitor run with the parser locked and must not call
+     * back into it.
+     * 
+     * @param predicate Function that returns true for matching sections
+     * @param visitor Receives each matching section
+     * @return Number of matching sections
+     */
+    size_t forEachSectionWhere(
+        const std::function<bool(const ConfigSectionData&)>& predicate,
+        const std::function<void(const ConfigSectionData&)>& visitor) const;
+
     /**
      * @brief Find first parameter matching a predicate
+     * 
+     * The non-const overload unshares the containing section like getSection().
+     * 
      * @param predicate Function that returns true for matching parameter
      * @return Pointer to first matching parameter or nullptr
      */
     ConfigParameter* findWhere(std::function<bool(const ConfigParameter&)> predicate);
     const ConfigParameter* findWhere(std::function<bool(const ConfigParameter&)> predicate) const;
 
+    /**
+     * @brief Get all parameters matching a predicate (lambda overload)
+     * 
+     * Calls the predicate directly instead of through std::function.
+     * 
+     * @param predicate Callable returning true for matching parameters
+     * @return Vector of matching parameters
+     */
+    template <typename Predicate,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<Predicate>,
+                                                           std::function<bool(const ConfigParameter&)>>>>
+    std::vector<ConfigParameter> getParametersWhere(Predicate&& predicate) const;
+
+    /**
+     * @brief Find first parameter matching a predicate (lambda overload)
+     * @param predicate Callable returning true for the wanted parameter
+     * @return Pointer to first matching parameter or nullptr
+     */
+    template <typename Predicate,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<Predicate>,
+                                                           std::function<bool(const ConfigParameter&)>>>>
+    ConfigParameter* findWhere(Predicate&& predicate);
+    template <typename Predicate,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<Predicate>,
+                                                           std::function<bool(const ConfigParameter&)>>>>
+    const ConfigParameter* findWhere(Predicate&& predicate) const;
+
+    /**
+     * @brief Get all parameters matching a predicate, evaluated in parallel
+     * 
+     * Sections are split into contiguous chunks of similar parameter count,
+     * scanned on worker threads and the results concatenated, so the order
+     * matches getParametersWhere(). The predicate must be safe to call
+     * concurrently; exceptions it throws are rethrown to the caller.
+     * 
+     * @param predicate Callable returning true for matching parameters
+     * @param threads Number of chunks (0 = hardware concurrency); at most the pool size + 1 run at once
+     * @return Vector of matching parameters
+     */
+    template <typename Predicate>
+    std::vector<ConfigParameter> getParametersWhereParallel(Predicate&& predicate, size_t threads = 0) const;
+
+    /**
+     * @brief Find first parameter matching a predicate, evaluated in parallel
+     * 
+     * Returns the same parameter as findWhere(): the first match in
+     * section/key order. Chunks after an already found match stop early.
+     * 
+     * @param predicate Callable returning true for the wanted parameter
+     * @param threads Number of chunks (0 = hardware concurrency); at most the pool size + 1 run at once
+     * @return Pointer to first matching parameter or nullptr
+     */
+    template <typename Predicate>
+    const ConfigParameter* findWhereParallel(Predicate&& predicate, size_t threads = 0) const;
+
     /**
      * @brief Get parameters by key pattern (regex)
      * @param pattern Regular expression pattern for keys
@@ -954,6 +2016,73 @@ public:
      */
     std::vector<ConfigParameter> getParametersByValuePattern(const std::string& pattern) const;
 
+    /**
+     * @brief Find parameters whose key matches a pattern, without copying
+     * 
+     * The pattern is compiled through the parser's pattern cache. Returned
+     * pointers stay valid until the parser is next modified.
+     * 
+     * @param pattern Regular expression pattern for keys
+     * @return Pointers to matching parameters
+     */
+    std::vector<const ConfigParameter*> findParametersByKeyPattern(const std::string& pattern) const;
+    std::vector<const ConfigParameter*> findParametersByKeyPattern(const CompiledPattern& pattern) const;
+
+    /**
+     * @brief Find parameters whose value matches a pattern, without copying
+     * 
+     * The pattern is compiled through the parser's pattern cache. Returned
+     * pointers stay valid until the parser is next modified.
+     * 
+     * @param pattern Regular expression pattern for values
+     * @return Pointers to matching parameters
+     */
+    std::vector<const ConfigParameter*> findParametersByValuePattern(const std::string& pattern) const;
+    std::vector<const ConfigParameter*> findParametersByValuePattern(const CompiledPattern& pattern) const;
+
+    /**
+     * @brief Visit parameters whose key matches a compiled pattern
+     * 
+     * The visitor runs with the parser locked and must not call back into it.
+     * 
+     * @param pattern Compiled key pattern
+     * @param visitor Receives the section and each matching parameter
+     * @return Number of matching parameters
+     */
+    size_t forEachParameterByKeyPattern(
+        const CompiledPattern& pattern,
+        const std::function<void(const ConfigSectionData&, const ConfigParameter&)>& visitor) const;
+
+    /**
+     * @brief Visit parameters whose value matches a compiled pattern
+     * 
+     * The visitor runs with the parser locked and must not call back into it.
+     * 
+     * @param pattern Compiled value pattern
+     * @param visitor Receives the section and each matching parameter
+     * @return Number of matching parameters
+     */
+    size_t forEachParameterByValuePattern(
+        const CompiledPattern& pattern,
+        const std::function<void(const ConfigSectionData&, const ConfigParameter&)>& visitor) const;
+
+    /**
+     * @brief Get a compiled pattern from the parser's LRU cache
+     * 
+     * Compiles and caches the pattern on a miss. Invalid patterns are
+     * returned (and cached) too; check isValid().
+     * 
+     * @param pattern Regular expression
+     * @return Shared compiled pattern
+     */
+    std::shared_ptr<const CompiledPattern> getCompiledPattern(const std::string& pattern) const;
+
+    /**
+     * @brief Set how many compiled patterns are cached
+     * @param capacity Maximum cached patterns (0 disables caching)
+     */
+    void setPatternCacheCapacity(size_t capacity);
+
     /**
      * @brief Get parameters by type
      * @param type Type to filter by ("string", "int", "float", "bool", "array")
@@ -961,6 +2090,62 @@ public:
      */
     std::vector<ConfigParameter> getParametersByType(const std::string& type) const;
 
+    /**
+     * @brief Find parameters by type, without copying
+     * 
+     * Served from per-section posting lists that are rebuilt only for
+     * sections modified since the last type query. Only sections listed as
+     * holding the type are visited, so the cost follows the result size
+     * rather than the section count. Returned pointers stay
+     * valid until the parser is next modified. Edits through a section
+     * pointer kept from before the last type query are not tracked; get a
+     * fresh one from getSection() instead.
+     * 
+     * @param type Type to filter by ("string", "int", "float", "bool", "array")
+     * @return Pointers to parameters with matching type, in section/key order
+     */
+    std::vector<const ConfigParameter*> findParametersByType(const std::string& type) const;
+
+    /**
+     * @brief Count parameters of one type
+     * @param type Type to count
+     * @return Number of parameters with that type
+     */
+    size_t getParameterCountByType(const std::string& type) const;
+
+    /**
+     * @brief Count parameters of every type
+     * @return Map of type to parameter count (types with no parameters omitted)
+     */
+    std::map<std::string, size_t> getParameterCountsByType() const;
+
+    /**
+     * @brief Visit parameters matching a compiled query
+     * 
+     * Sections and types fixed by top-level AND conditions are served from
+     * the section list and type index; the full expression is then checked
+     * on the remaining candidates. The visitor runs with the parser locked
+     * and must not call back into it.
+     * 
+     * @param query Compiled query
+     * @param visitor Receives the section and each matching parameter
+     * @return Number of matching parameters
+     */
+    size_t queryParameters(
+        const ConfigQuery& query,
+        const std::function<void(const ConfigSectionData&, const ConfigParameter&)>& visitor) const;
+
+    /**
+     * @brief Find parameters matching a query expression, without copying
+     * 
+     * Sets the last error if the expression does not compile. Returned
+     * pointers stay valid until the parser is next modified.
+     * 
+     * @param expression Query expression (see ConfigQuery)
+     * @return Pointers to matching parameters, in section/key order
+     */
+    std::vector<const ConfigParameter*> queryParameters(const std::string& expression) const;
+
     // ============ Path-Based Access (RFC 6901 JSON Pointer) ============
 
     /**
@@ -971,11 +2156,55 @@ public:
      *  - "/section" → Get section (returns JSON representation)
      *  - "/" → Get root (all sections as JSON)
      * 
+     * Section and root paths serialize their contents; prefer dumpByPath()
+     * for that and hasPath() to test existence.
+     * 
      * @param path JSON Pointer path
      * @return Parameter value or empty string if not found
      */
     std::string getValueByPath(const std::string& path) const;
 
+    /**
+     * @brief Serialize whatever a path points to
+     * 
+     * Returns the JSON representation of a section or of the root, or the
+     * value of a parameter.
+     * 
+     * @param path JSON Pointer path
+     * @return Serialized content or empty string if not found
+     */
+    std::string dumpByPath(const std::string& path) const;
+
+    /**
+     * @brief Read a parameter as a floating-point number
+     * 
+     * Does not allocate or throw. Fortran exponents ("1.0D-10") are accepted.
+     * 
+     * @param path Parameter path ("/section/key")
+     * @param value Receives the number on success
+     * @return True if the parameter exists and is numeric
+     */
+    bool getDoubleByPath(const std::string& path, double& value) const;
+
+    /**
+     * @brief Read a parameter as an integer
+     * @param path Parameter path ("/section/key")
+     * @param value Receives the number on success
+     * @return True if the parameter exists and is an integer in range
+     */
+    bool getIntByPath(const std::string& path, int& value) const;
+
+    /**
+     * @brief Read a parameter as a boolean
+     * 
+     * Accepts .TRUE./.FALSE., true/false, yes/no and 1/0 (case-insensitive).
+     * 
+     * @param path Parameter path ("/section/key")
+     * @param value Receives the flag on success
+     * @return True if the parameter exists and is a boolean
+     */
+    bool getBoolByPath(const std::string& path, bool& value) const;
+
     /**
      * @brief Set value by JSON Pointer path (RFC 6901)
      * 
@@ -985,88 +2214,414 @@ public:
      *  - "/section/key" → Set parameter value
      *  - "/section" → Create section (empty)
      * 
-     * @param path JSON Pointer path
-     * @param value Value to set
-     * @return True if successful
+     * @param path JSON Pointer path
+     * @param value Value to set
+     * @return True if successful
+     */
+    bool setValueByPath(const std::string& path, const std::string& value);
+
+    /**
+     * @brief Get parameter value through a pre-parsed path
+     * 
+     * Section and root paths behave like getValueByPath(const std::string&).
+     * 
+     * @param handle Compiled path
+     * @return Parameter value or empty string if not found
+     */
+    std::string getValueByPath(const PathHandle& handle) const;
+
+    /**
+     * @brief Set parameter value through a pre-parsed path
+     * 
+     * Overwriting an existing, unshared parameter is done in place
+     * without invalidating other handles; otherwise this behaves like
+     * setValueByPath(const std::string&, const std::string&).
+     * 
+     * @param handle Compiled path
+     * @param value Value to set
+     * @return True if successful
+     */
+    bool setValueByPath(const PathHandle& handle, const std::string& value);
+
+    /**
+     * @brief Read a parameter as a floating-point number through a compiled path
+     * @param handle Parameter path handle
+     * @param value Receives the number on success
+     * @return True if the parameter exists and is numeric
+     */
+    bool getDoubleByPath(const PathHandle& handle, double& value) const;
+
+    /**
+     * @brief Read a parameter as an integer through a compiled path
+     * @param handle Parameter path handle
+     * @param value Receives the number on success
+     * @return True if the parameter exists and is an integer in range
+     */
+    bool getIntByPath(const PathHandle& handle, int& value) const;
+
+    /**
+     * @brief Read a parameter as a boolean through a compiled path
+     * @param handle Parameter path handle
+     * @param value Receives the flag on success
+     * @return True if the parameter exists and is a boolean
+     */
+    bool getBoolByPath(const PathHandle& handle, bool& value) const;
+
+    /**
+     * @brief Read many parameters in one locked pass
+     * 
+     * Paths are grouped by section so each section is looked up once.
+     * Only "/section/key" paths are accepted; others report INVALID_PATH.
+     * 
+     * @param paths Parameter paths
+     * @return One result per path, in input order
+     */
+    std::vector<PathResult> getValuesByPaths(const std::vector<std::string>& paths) const;
+
+    /**
+     * @brief Set many parameters in one locked pass
+     * 
+     * Equivalent to calling setValueByPath() for each entry in order
+     * (later duplicates win), but paths are parsed up front and grouped
+     * by section so each section is looked up and detached once.
+     * 
+     * @param updates (path, value) pairs
+     * @return One status per update, in input order (OK, CREATED or INVALID_PATH)
+     */
+    std::vector<PathStatus> setValuesByPaths(
+        const std::vector<std::pair<std::string, std::string>>& updates);
+
+    /**
+     * @brief Set many parameters in one locked pass
+     * @param updates Map of path to value
+     * @return One status per entry, in map order
+     */
+    std::vector<PathStatus> setValuesByPaths(const std::map<std::string, std::string>& updates);
+
+    /**
+     * @brief Check if path exists
+     * 
+     * Looks the path up without serializing anything, so empty sections
+     * and parameters with empty values exist too. The root path always
+     * exists; paths not starting with '/' never do.
+     * 
+     * @param path JSON Pointer path
+     * @return True if path exists
+     */
+    bool hasPath(const std::string& path) const;
+
+    /**
+     * @brief Delete value by path
+     * @param path JSON Pointer path
+     * @return True if successfully deleted
+     */
+    bool deleteByPath(const std::string& path);
+
+    /**
+     * @brief Get all paths in configuration
+     * @return Vector of all valid paths (excluding root)
+     */
+    std::vector<std::string> getAllPaths() const;
+
+    /**
+     * @brief Stream paths matching a glob pattern
+     * 
+     * Each pattern component is matched against one path component:
+     *  - "*" any run of characters, "?" one character
+     *  - "[abc]", "[a-z]", "[!0-9]" character classes
+     *  - "**" as a whole component matches zero or more components
+     * 
+     * Examples, as component lists: (asteroids, *) lists a section's
+     * parameters, (*, tolerance) finds a key in every section and
+     * (**, .step*) matches keys at any depth.
+     * A literal section component costs one name comparison per section
+     * (no glob matching); a literal final key is looked up directly and a
+     * literal key prefix narrows the parameter range, so parameters outside
+     * the matched sections and key range are never visited.
+     * 
+     * The callback runs with the parser locked and must not call back into
+     * it. For section matches param is nullptr.
+     * 
+     * @param pattern Glob path pattern
+     * @param callback Receives (path, section, param); return false to stop
+     * @return Number of matches delivered
+     */
+    size_t findPaths(const std::string& pattern,
+                     const std::function<bool(const std::string& path,
+                                              const ConfigSectionData& section,
+                                              const ConfigParameter* param)>& callback) const;
+
+    /**
+     * @brief Parse JSON Pointer path into components
+     * @param path Path to parse
+     * @return Vector of path components
+     */
+    static std::vector<std::string> parsePath(const std::string& path);
+
+    /**
+     * @brief Escape special characters in JSON Pointer token
+     * @param token Token to escape
+     * @return Escaped token
+     */
+    static std::string escapePathToken(const std::string& token);
+
+    /**
+     * @brief Unescape special characters in JSON Pointer token
+     * @param token Token to unescape
+     * @return Unescaped token
+     */
+    static std::string unescapePathToken(const std::string& token);
+
+private:
+    friend class VersionedOopParser;
+
+    std::vector<std::shared_ptr<ConfigSectionData>> sections_;  ///< Configuration sections (copy-on-write)
+    mutable std::unordered_set<const ConfigSectionData*> lentSections_;  ///< Sections handed out by mutable accessors (never shared)
+    mutable std::string lastError_;                     ///< Last error message
+    std::shared_ptr<const ConfigSchema> schema_;        ///< Current validation schema (shared with copies)
+    mutable std::mutex sectionsMutex_;                  ///< Mutex for thread-safe section access
+    MergeStats mergeStats_;                             ///< Statistics from last merge operation
+    uint64_t generation_;                               ///< Layout generation (PathHandle caches)
+
+    /// Section a PathHandle resolved to, valid while generation matches
+    struct PathSlot {
+        uint64_t generation = 0;
+        size_t sectionIndex = 0;
+    };
+    static constexpr size_t kMaxPathSlots = 1024;       ///< Path cache is cleared when it grows past this
+    mutable std::unordered_map<uint64_t, PathSlot> pathSlots_;  ///< Resolved PathHandles by handle id
+
+    /// Cached pattern, most recently used first
+    using PatternCacheList = std::list<std::pair<std::string, std::shared_ptr<const CompiledPattern>>>;
+    mutable std::mutex patternCacheMutex_;              ///< Mutex for the pattern cache
+    mutable PatternCacheList patternCache_;             ///< Compiled patterns in LRU order
+    mutable std::unordered_map<std::string, PatternCacheList::iterator> patternCacheIndex_;  ///< Pattern lookup
+    size_t patternCacheCapacity_ = 32;                  ///< Maximum cached patterns
+
+    /// Posting lists of one section for type queries
+    struct TypeIndexEntry {
+        std::weak_ptr<ConfigSectionData> section;       ///< Indexed section (detects reuse of its address)
+        std::map<std::string, std::vector<std::string>, std::less<>> byType;  ///< Parameter keys per type
+        size_t position = 0;                            ///< Index in sections_ (orders query results)
+    };
+    mutable std::unordered_map<const ConfigSectionData*, TypeIndexEntry> typeIndex_;  ///< Type index per section
+    mutable std::unordered_set<const ConfigSectionData*> typeIndexDirty_;  ///< Sections changed in place
+    mutable std::map<std::string, size_t, std::less<>> typeCounts_;  ///< Parameter count per type
+    mutable std::map<std::string, std::unordered_set<const ConfigSectionData*>, std::less<>> typeSections_;  ///< Sections holding each type
+    mutable uint64_t indexedGeneration_ = 0;            ///< Generation of the last type index resync (0 = never)
+
+    /// Cached revalidate() results of one section
+    struct ValidationCacheEntry {
+        std::weak_ptr<ConfigSectionData> section;       ///< Validated section (detects reuse of its address)
+        size_t ruleIndex = 0;                           ///< Matching CompiledSchema section rule (npos if unknown)
+        std::vector<ValidationIssue> issues;            ///< Issues found in this section
+    };
+    std::shared_ptr<const CompiledSchema> compiledSchema_;  ///< Attached schema, compiled for revalidate() (shared with copies)
+    mutable std::unordered_map<const ConfigSectionData*, ValidationCacheEntry> validationCache_;  ///< Results per section
+    mutable std::unordered_set<const ConfigSectionData*> validationDirty_;  ///< Sections changed since revalidate()
+    mutable std::vector<ValidationIssue> validationMissing_;  ///< Missing required sections
+    mutable std::vector<ValidationIssue> validationCross_;  ///< Failed cross-parameter constraints
+    mutable size_t validationIssueCount_ = 0;           ///< Issues across validationCache_
+    mutable uint64_t validatedGeneration_ = 0;          ///< Generation of the last revalidate() (0 = never)
+    bool schemaTypedLoading_ = false;                   ///< Loaders decode parameters by schema type
+
+    /**
+     * @brief Parse a single line from OOP file
+     * @param line Line to parse
+     * @param currentSection Current section being processed
+     * @return True if line was successfully parsed
+     */
+    bool parseLine(const std::string& line, ConfigSectionData& currentSection);
+
+    /**
+     * @brief Check if line is a comment
+     * @param line Line to check
+     * @return True if line is a comment
+     */
+    static bool isComment(const std::string& line);
+
+    /**
+     * @brief Check if line starts a new section
+     * @param line Line to check
+     * @return Section name if it's a section header, empty string otherwise
+     */
+    static std::string isSection(const std::string& line);
+
+    /**
+     * @brief Parse array value enclosed in brackets
+     * @param value String value containing array
+     * @return Vector of parsed array elements
+     */
+    static std::vector<std::string> parseArrayValue(const std::string& value);
+
+    /**
+     * @brief Make a section exclusively owned before modifying it
+     * 
+     * Sections may be shared with clones and version snapshots; a shared
+     * section is replaced by a private copy first (copy-on-write).
+     * 
+     * @param section Section slot in sections_
+     * @return Mutable reference to the now unshared section
+     */
+    ConfigSectionData& detachSection(std::shared_ptr<ConfigSectionData>& section);
+
+    /**
+     * @brief Unshare a section about to be returned through a mutable pointer
+     * 
+     * Writes through such pointers bypass detachSection(), so the section is
+     * recorded and copyFrom() gives copies a private copy of it instead of
+     * sharing it.
+     * 
+     * @param section Section slot in sections_
+     * @return Mutable reference to the now unshared section
+     */
+    ConfigSectionData& lendSection(std::shared_ptr<ConfigSectionData>& section);
+
+    /**
+     * @brief Invalidate cached PathHandle resolutions
+     * 
+     * Called whenever sections or parameters are added, removed or
+     * replaced, i.e. whenever cached pointers into sections_ may dangle.
+     */
+    void bumpGeneration();
+
+    /**
+     * @brief Find the parameter a handle addresses, using the path cache (assumes lock is held)
+     * 
+     * Only the section slot is cached; the key is looked up on every call,
+     * so parameters erased through a section pointer are never returned.
+     * 
+     * @param handle Parameter path handle
+     * @param sectionIndex Set to the section slot (sections_.size() if missing)
+     * @return Parameter or nullptr if missing
+     */
+    ConfigParameter* resolvePath_unlocked(const PathHandle& handle, size_t& sectionIndex) const;
+
+    /**
+     * @brief Reindex sections added, replaced or changed since the last type query (assumes lock is held)
+     *
+     * Only walks sections_ when the generation moved; otherwise just the
+     * dirty sections are reindexed.
+     */
+    void refreshTypeIndex_unlocked() const;
+
+    /**
+     * @brief Sections indexed as holding a type, in sections_ order (assumes lock is held)
+     * 
+     * Costs O(k log k) for the k sections listed under the type, so type
+     * queries never walk sections without matches.
      */
-    bool setValueByPath(const std::string& path, const std::string& value);
+    std::vector<const ConfigSectionData*> sectionsWithType_unlocked(std::string_view type) const;
 
     /**
-     * @brief Check if path exists
-     * @param path JSON Pointer path
-     * @return True if path exists
+     * @brief Call visitor for each parameter of a section listed under a type (assumes lock is held)
+     *
+     * Keys are looked up again, so parameters erased or retyped through a
+     * section pointer since the last reindex are skipped.
      */
-    bool hasPath(const std::string& path) const;
+    template<typename Visitor>
+    void forEachIndexedParameter_unlocked(const ConfigSectionData& section, std::string_view type,
+                                          Visitor&& visitor) const {
+        const auto& byType = typeIndex_.find(&section)->second.byType;
+        auto type_it = byType.find(type);
+        if (type_it == byType.end()) {
+            return;
+        }
+        for (const std::string& key : type_it->second) {
+            auto param_it = section.parameters.find(key);
+            if (param_it != section.parameters.end() && param_it->second.type == type) {
+                visitor(param_it->second);
+            }
+        }
+    }
 
     /**
-     * @brief Delete value by path
-     * @param path JSON Pointer path
-     * @return True if successfully deleted
+     * @brief Bring the revalidate() cache up to date (assumes lock is held)
+     * @return True if the configuration has no issues
      */
-    bool deleteByPath(const std::string& path);
+    bool revalidate_unlocked() const;
 
     /**
-     * @brief Get all paths in configuration
-     * @return Vector of all valid paths (excluding root)
+     * @brief Check one section against a compiled schema
+     * @param schema Compiled schema
+     * @param section Section to check
+     * @param issues Output vector (issues are appended)
+     * @return Index of the matching section rule, or npos if the schema does not describe it
      */
-    std::vector<std::string> getAllPaths() const;
+    static size_t validateSection(const CompiledSchema& schema, const ConfigSectionData& section,
+                                  std::vector<ValidationIssue>& issues);
 
     /**
-     * @brief Parse JSON Pointer path into components
-     * @param path Path to parse
-     * @return Vector of path components
+     * @brief Evaluate a cross-parameter constraint on this configuration (assumes lock is held)
+     * @param constraint Compiled constraint
+     * @return False if the constraint fails or references a value that is neither
+     *         a number nor an ISO date; true if it holds or references an absent parameter
      */
-    static std::vector<std::string> parsePath(const std::string& path);
+    bool checkCrossConstraint_unlocked(const CrossConstraint& constraint) const;
 
     /**
-     * @brief Escape special characters in JSON Pointer token
-     * @param token Token to escape
-     * @return Escaped token
+     * @brief Check if loaders should decode by schema type
+     * @return True if schema-typed loading is enabled and a schema is attached
      */
-    static std::string escapePathToken(const std::string& token);
+    bool schemaTypedLoadActive() const;
 
     /**
-     * @brief Unescape special characters in JSON Pointer token
-     * @param token Token to unescape
-     * @return Unescaped token
+     * @brief Type a loaded section by schema and add its defaults (assumes lock is held)
+     * @param section Section just read by a loader
      */
-    static std::string unescapePathToken(const std::string& token);
+    void applySchemaTypes(ConfigSectionData& section) const;
 
-private:
-    std::vector<ConfigSectionData> sections_;           ///< Configuration sections
-    mutable std::string lastError_;                     ///< Last error message
-    std::unique_ptr<ConfigSchema> schema_;              ///< Current validation schema
-    mutable std::mutex sectionsMutex_;                  ///< Mutex for thread-safe section access
-    MergeStats mergeStats_;                             ///< Statistics from last merge operation
+    /**
+     * @brief Add optional schema sections missing after a load, with their defaults (assumes lock is held)
+     * 
+     * Only sections that would get at least one default_value are added.
+     */
+    void addDefaultSections();
 
     /**
-     * @brief Parse a single line from OOP file
-     * @param line Line to parse
-     * @param currentSection Current section being processed
-     * @return True if line was successfully parsed
+     * @brief Split sections into contiguous chunks of similar parameter count (assumes lock is held)
+     * @param threads Requested worker count (0 = hardware concurrency)
+     * @return Chunk boundaries: chunk i covers sections [bounds[i], bounds[i+1])
      */
-    bool parseLine(const std::string& line, ConfigSectionData& currentSection);
+    std::vector<size_t> partitionSections_unlocked(size_t threads) const;
 
     /**
-     * @brief Check if line is a comment
-     * @param line Line to check
-     * @return True if line is a comment
+     * @brief Run tasks 0..count-1 on the shared worker pool and wait for them
+     * 
+     * The pool is created once per process (hardware concurrency - 1
+     * threads) and the calling thread runs tasks as well. Runs inline when
+     * count is 1. The first exception thrown by a task is rethrown after
+     * all tasks finish.
+     * 
+     * @param count Number of tasks
+     * @param task Task body, called with the task index
      */
-    static bool isComment(const std::string& line);
+    static void runParallel(size_t count, const std::function<void(size_t)>& task);
 
     /**
-     * @brief Check if line starts a new section
-     * @param line Line to check
-     * @return Section name if it's a section header, empty string otherwise
+     * @brief Find a section by raw (escaped) path token (assumes lock is held)
+     * @param token Path token
+     * @return Section or nullptr
      */
-    static std::string isSection(const std::string& line);
+    const ConfigSectionData* findPathSection_unlocked(std::string_view token) const;
 
     /**
-     * @brief Parse array value enclosed in brackets
-     * @param value String value containing array
-     * @return Vector of parsed array elements
+     * @brief Find a parameter by raw (escaped) path tokens (assumes lock is held)
+     * @param sectionToken Section token
+     * @param keyToken Parameter key token
+     * @return Parameter or nullptr
      */
-    static std::vector<std::string> parseArrayValue(const std::string& value);
+    const ConfigParameter* findPathParameter_unlocked(std::string_view sectionToken,
+                                                      std::string_view keyToken) const;
+
+    /**
+     * @brief Compare with another configuration
+     * @param other Configuration to compare with
+     * @param includeUnchanged Emit UNCHANGED entries (sections shared with
+     *        @p other are skipped without visiting their parameters otherwise)
+     * @return Vector of diff entries
+     */
+    std::vector<DiffEntry> diff_impl(const OopParser& other, bool includeUnchanged) const;
 
 #ifdef IOC_CONFIG_YAML_SUPPORT
     /**
@@ -1177,13 +2732,26 @@ private:
  * @brief Batch operation statistics
  */
 struct BatchStats {
+    /**
+     * @brief Schema validation outcome for one file
+     */
+    struct FileResult {
+        std::string filepath;                   ///< File that was validated
+        bool loaded = false;                    ///< False if the file could not be read or parsed
+        std::vector<ValidationIssue> issues;    ///< Schema issues (empty when valid)
+    };
+
     size_t total_files;
     size_t successful_operations;
     size_t failed_operations;
     std::vector<std::string> failed_files;
     std::vector<std::string> error_messages;
+    std::vector<FileResult> file_results;   ///< Per-file results (validateAllWithSchema only), in input order
+    double elapsed_seconds;                 ///< Wall time of the operation (validateAllWithSchema only)
+    double files_per_second;                ///< Throughput (validateAllWithSchema only)
 
-    BatchStats() : total_files(0), successful_operations(0), failed_operations(0) {}
+    BatchStats() : total_files(0), successful_operations(0), failed_operations(0),
+                   elapsed_seconds(0.0), files_per_second(0.0) {}
 
     std::string toString() const {
         std::ostringstream oss;
@@ -1192,6 +2760,9 @@ struct BatchStats {
         if (failed_operations > 0) {
             oss << " (" << failed_operations << " failed)";
         }
+        if (files_per_second > 0.0) {
+            oss << ", " << static_cast<size_t>(files_per_second) << " files/sec";
+        }
         return oss.str();
     }
 };
@@ -1232,6 +2803,34 @@ public:
      */
     BatchStats validateAll(const std::vector<std::string>& filepaths);
 
+    /**
+     * @brief Validate multiple configuration files against a schema in parallel
+     * 
+     * The schema is compiled once and shared read-only by the calling
+     * thread and the process-wide worker pool used by the parallel queries,
+     * which pull files from a common queue. Each file is loaded by
+     * its extension (OOP when unknown) and checked with
+     * OopParser::validateFull(). Per-file issues are kept in
+     * BatchStats::file_results; failed_files and error_messages hold one
+     * summary line per failing file.
+     * 
+     * @param filepaths Vector of file paths to validate
+     * @param schema Schema to validate against
+     * @param threads Concurrent workers (0 = hardware concurrency), capped at the pool size + 1
+     * @return BatchStats with per-file results and files/sec throughput
+     * 
+     * @example
+     * @code
+     * BatchStats stats = batch.validateAllWithSchema(files, OopParser::createDefaultSchema());
+     * for (const auto& result : stats.file_results)
+     *     for (const auto& issue : result.issues)
+     *         std::cerr << result.filepath << ": " << issue.toString() << "\n";
+     * @endcode
+     */
+    BatchStats validateAllWithSchema(const std::vector<std::string>& filepaths,
+                                     const ConfigSchema& schema,
+                                     size_t threads = 0);
+
     /**
      * @brief Convert multiple files from one format to another
      * 
@@ -1310,6 +2909,36 @@ private:
                                  const std::string& targetExtension);
 };
 
+/**
+ * @brief Storage strategy for version history
+ */
+enum class VersionStorageMode {
+    FULL_SNAPSHOT = 0,  ///< Every version stores a complete copy (default)
+    DELTA = 1           ///< Periodic keyframes plus per-version parameter deltas
+};
+
+/**
+ * @brief When the version journal is flushed to stable storage
+ */
+enum class JournalSyncMode {
+    NONE = 0,           ///< Leave flushing to the operating system
+    CHECKPOINT = 1,     ///< fsync after every checkpoint record (default)
+    EVERY_RECORD = 2    ///< fsync after every record
+};
+
+/**
+ * @brief Options for an on-disk version journal
+ */
+struct JournalOptions {
+    JournalSyncMode sync_mode;          ///< fsync policy
+    size_t checkpoint_interval;         ///< Records per full checkpoint (>= 1)
+    size_t compact_threshold_bytes;     ///< Compact in background past this size (0 = manual only)
+
+    JournalOptions()
+        : sync_mode(JournalSyncMode::CHECKPOINT), checkpoint_interval(64),
+          compact_threshold_bytes(0) {}
+};
+
 /**
  * @brief Version history entry for versioned configurations
  */
@@ -1317,10 +2946,14 @@ struct VersionEntry {
     size_t version;                             ///< Version number (auto-increment)
     std::string timestamp;                      ///< ISO 8601 timestamp
     std::string description;                    ///< Optional version description
-    std::shared_ptr<OopParser> snapshot;        ///< Configuration snapshot (shared ownership)
+    std::shared_ptr<OopParser> snapshot;        ///< Configuration snapshot (null for delta entries)
+    bool is_keyframe;                           ///< True if snapshot holds the full configuration
+    std::vector<DiffEntry> delta;               ///< Changes since the previous version (empty for the oldest)
+    size_t size_bytes;                          ///< Memory attributed to this entry (history limits)
 
     VersionEntry(size_t v, const std::string& ts, const std::string& desc = "")
-        : version(v), timestamp(ts), description(desc), snapshot(std::make_shared<OopParser>()) {}
+        : version(v), timestamp(ts), description(desc), snapshot(std::make_shared<OopParser>()),
+          is_keyframe(true), size_bytes(0) {}
     
     // Default copy/move semantics work with shared_ptr
     VersionEntry(const VersionEntry&) = default;
@@ -1414,13 +3047,41 @@ public:
      */
     std::vector<VersionEntry> getHistory() const;
 
+    /**
+     * @brief Visit every retained version without copying the history
+     * 
+     * Entries are visited oldest first while the history lock is held, so
+     * the visitor must not call back into this parser's versioning methods.
+     * 
+     * @param visitor Callback invoked once per version entry
+     * 
+     * @example
+     * @code
+     * parser.forEachVersion([](const VersionEntry& entry) {
+     *     std::cout << entry.version << ": " << entry.description << std::endl;
+     * });
+     * @endcode
+     */
+    void forEachVersion(const std::function<void(const VersionEntry&)>& visitor) const;
+
     /**
      * @brief Get specific version
+     * 
+     * Lookup is O(1): retained versions are numbered consecutively.
+     * The pointer stays valid until the entry is evicted or the
+     * history is cleared.
+     * 
      * @param version Version number to retrieve
      * @return Pointer to VersionEntry or nullptr if not found
      */
     const VersionEntry* getVersion(size_t version) const;
 
+    /**
+     * @brief Get the oldest version still held in history
+     * @return Oldest retained version number (0 if not versioned)
+     */
+    size_t getOldestVersion() const;
+
     /**
      * @brief Create a new version (manual checkpoint)
      * 
@@ -1490,12 +3151,24 @@ public:
      * 
      * Compares two versions and returns the differences.
      * Useful for audit trails and change analysis.
+     * Entries are oriented like `to.diff(from)`: they turn toVersion
+     * into fromVersion.
+     * 
+     * Composition only applies when onlyChanges is passed as true: the
+     * per-version change sets stored in history are then composed, so
+     * diffing nearby versions costs time proportional to the parameters
+     * changed in between. Long spans with more changes than the
+     * configuration has parameters fall back to a snapshot diff. The
+     * default (false) always diffs full snapshots, including UNCHANGED
+     * entries.
      * 
      * @param fromVersion First version to compare
      * @param toVersion Second version to compare
+     * @param onlyChanges Omit UNCHANGED entries and compose stored change sets (default false)
      * @return Vector of DiffEntry records
      */
-    std::vector<DiffEntry> getVersionDiff(size_t fromVersion, size_t toVersion) const;
+    std::vector<DiffEntry> getVersionDiff(size_t fromVersion, size_t toVersion,
+                                          bool onlyChanges = false) const;
 
     /**
      * @brief Export version history as JSON
@@ -1507,15 +3180,299 @@ public:
     nlohmann::json getHistoryAsJson() const;
 
     /**
-     * @brief Destructor
+     * @brief Select how new versions are stored
+     * 
+     * In DELTA mode only every `keyframeInterval`-th version keeps a full
+     * snapshot; the versions in between store the parameter changes since
+     * their predecessor and are reconstructed by replay on rollback.
+     * Existing history entries are kept as they are.
+     * 
+     * @param mode Storage mode for versions created from now on
+     * @param keyframeInterval Versions per keyframe in DELTA mode (>= 1)
+     * @return True if successful, false if keyframeInterval is 0
+     * 
+     * @example
+     * @code
+     * VersionedOopParser parser;
+     * parser.setStorageMode(VersionStorageMode::DELTA, 32);
+     * parser.enableVersioning("Initial config");
+     * @endcode
+     */
+    bool setStorageMode(VersionStorageMode mode, size_t keyframeInterval = 16);
+
+    /**
+     * @brief Get current storage mode
+     * @return Storage mode used for new versions
+     */
+    VersionStorageMode getStorageMode() const;
+
+    /**
+     * @brief Get the full configuration of a version
+     * 
+     * Returns the stored snapshot for keyframes, or a configuration
+     * rebuilt from the nearest keyframe for delta entries.
+     * 
+     * @param version Version number
+     * @return Configuration snapshot or nullptr if not found
+     */
+    std::shared_ptr<const OopParser> getVersionSnapshot(size_t version) const;
+
+    /**
+     * @brief Estimate memory held by the version history
+     * @return Approximate size in bytes of all snapshots and deltas
+     */
+    size_t getHistoryMemoryUsage() const;
+
+    /**
+     * @brief Bound the version history
+     * 
+     * Once a limit is exceeded the oldest versions are evicted (the latest
+     * version is always kept). If the new oldest entry is a delta it is
+     * turned into a keyframe first. The byte limit applies to the same
+     * estimate that getHistoryMemoryUsage() reports, tracked incrementally.
+     * 
+     * @param maxVersions Maximum number of retained versions (0 = unlimited)
+     * @param maxBytes Maximum approximate history size in bytes (0 = unlimited)
+     * 
+     * @example
+     * @code
+     * VersionedOopParser parser;
+     * parser.setHistoryLimits(500, 64 * 1024 * 1024);
+     * parser.enableVersioning("Service start");
+     * @endcode
+     */
+    void setHistoryLimits(size_t maxVersions, size_t maxBytes = 0);
+
+    /**
+     * @brief Get maximum number of retained versions
+     * @return Version limit (0 = unlimited)
+     */
+    size_t getMaxVersions() const;
+
+    /**
+     * @brief Get maximum approximate history size
+     * @return Byte limit (0 = unlimited)
+     */
+    size_t getMaxHistoryBytes() const;
+
+    // ============ Version Journal ============
+
+    /**
+     * @brief Attach an append-only journal file to the version history
+     * 
+     * The journal is a write-ahead log with one JSON record per line: a full
+     * checkpoint every `checkpoint_interval` records and the parameter
+     * changes of each version in between; rollbacks are recorded too. A
+     * record is written before the history changes, and createVersion(),
+     * enableVersioning(), clearHistory() and rollback() fail if it cannot
+     * be written or synced. If the file already holds records, the history
+     * and the current configuration are recovered from it (a torn final
+     * record is discarded, other unreadable records are reported and
+     * skipped) and versioning is enabled. Otherwise the retained history,
+     * if any, is written as the initial content.
+     * 
+     * @param path Journal file path
+     * @param options Sync, checkpoint and compaction settings
+     * @return True if successful, false if the file cannot be read or written
+     * 
+     * @example
+     * @code
+     * VersionedOopParser parser;
+     * if (!parser.attachJournal("config.journal")) {
+     *     // handle I/O error
+     * }
+     * if (!parser.isVersioningEnabled()) {
+     *     parser.loadFromOop("config.oop");
+     *     parser.enableVersioning("Initial config");
+     * }
+     * @endcode
+     */
+    bool attachJournal(const std::string& path, const JournalOptions& options = JournalOptions());
+
+    /**
+     * @brief Stop writing to the journal
+     * 
+     * Waits for a running background compaction, then closes the file.
      */
-    virtual ~VersionedOopParser() = default;
+    void detachJournal();
+
+    /**
+     * @brief Check if a journal is attached
+     * @return True if versions are being journaled
+     */
+    bool isJournalAttached() const;
+
+    /**
+     * @brief Get current journal file size
+     * @return Size in bytes (0 if no journal is attached)
+     */
+    size_t getJournalSize() const;
+
+    /**
+     * @brief Rewrite the journal to hold only the retained history
+     * 
+     * Runs startJournalCompaction() and waits for it.
+     * 
+     * @return True if successful
+     */
+    bool compactJournal();
+
+    /**
+     * @brief Start compacting the journal on a background thread
+     * 
+     * The history is captured under the lock, written to a temporary file
+     * without blocking writers, and swapped in after copying any records
+     * appended in the meantime.
+     * 
+     * @return True if started, false if no journal or a compaction is running
+     */
+    bool startJournalCompaction();
+
+    /**
+     * @brief Wait for a background compaction to finish
+     * @return Result of the last compaction (true if none was started)
+     */
+    bool waitForJournalCompaction();
+
+    /**
+     * @brief Destructor (detaches the journal)
+     */
+    virtual ~VersionedOopParser();
 
 private:
-    std::vector<VersionEntry> versions_;       ///< Version history stack
+    std::deque<VersionEntry> versions_;        ///< Version history (oldest first, consecutive numbers)
     size_t currentVersion_;                    ///< Current active version
     bool versioningEnabled_;                   ///< Versioning state flag
     mutable std::mutex version_mutex_;         ///< Thread-safe access to versions
+    VersionStorageMode storageMode_;           ///< Storage mode for new versions
+    size_t keyframeInterval_;                  ///< Versions per keyframe in DELTA mode
+    size_t deltasSinceKeyframe_;               ///< Delta entries after the last keyframe
+    std::shared_ptr<OopParser> tipState_;      ///< Configuration of the latest version
+    size_t maxVersions_;                       ///< History length limit (0 = unlimited)
+    size_t maxHistoryBytes_;                   ///< History size limit (0 = unlimited)
+    size_t historyBytes_;                      ///< Sum of VersionEntry::size_bytes
+    std::string journalPath_;                  ///< Attached journal path
+    FILE* journalFile_;                        ///< Journal opened for append (null if detached)
+    JournalOptions journalOptions_;            ///< Journal settings
+    size_t journalBytes_;                      ///< Journal size in bytes
+    size_t recordsSinceCheckpoint_;            ///< Journal records after the last checkpoint
+    size_t nextCompactionAt_;                  ///< Journal size that triggers automatic compaction
+    std::thread compactionThread_;             ///< Background compaction worker
+    std::atomic<bool> compactionRunning_;      ///< True while compaction is in progress
+    std::atomic<bool> compactionResult_;       ///< Outcome of the last compaction
+
+    /**
+     * @brief Append a version for the current configuration (assumes lock is held)
+     * 
+     * With a journal attached the record is written first; history is left
+     * unchanged if that fails.
+     * 
+     * @param description Version description
+     * @param reset Start a new history at version 1 with a full snapshot
+     * @return False if the journal record could not be written
+     */
+    bool appendVersion_unlocked(const std::string& description, bool reset);
+
+    /**
+     * @brief Add a configuration to history as the latest version (assumes lock is held)
+     * 
+     * Decides between keyframe and delta storage; does not journal or evict.
+     * 
+     * @param entry Version number, timestamp, description and the changes since the current tip
+     * @param state Configuration of that version (not modified afterwards)
+     * @param forceKeyframe Store a full snapshot regardless of storage mode
+     */
+    void storeVersion_unlocked(VersionEntry entry, std::shared_ptr<OopParser> state, bool forceKeyframe);
+
+    /**
+     * @brief Write a version about to be added to the journal (assumes lock is held)
+     * @param entry Version metadata and its changes since the current tip
+     * @param state Configuration of that version
+     * @param forceCheckpoint Write a full checkpoint record
+     * @return True if the record was written
+     */
+    bool journalVersion_unlocked(const VersionEntry& entry, const OopParser& state, bool forceCheckpoint);
+
+    /**
+     * @brief Append one record line to the journal (assumes lock is held)
+     * 
+     * On a write or sync failure the file is cut back to its previous size.
+     * 
+     * @param record Journal record
+     * @param checkpoint True for checkpoint records (sync policy)
+     * @return True if written
+     */
+    bool writeJournalRecord_unlocked(const nlohmann::json& record, bool checkpoint);
+
+    /**
+     * @brief Rebuild history from journal records (assumes lock is held)
+     * 
+     * Records that cannot be read or applied are reported and skipped.
+     * 
+     * @param in Journal contents
+     * @param validBytes Set to the length up to the end of the last complete line
+     * @return Number of records replayed
+     */
+    size_t replayJournal_unlocked(std::istream& in, size_t& validBytes);
+
+    /**
+     * @brief Capture the retained history for serialization (assumes lock is held)
+     * @return Metadata and configuration of each retained version, oldest first
+     */
+    std::vector<std::pair<VersionEntry, std::shared_ptr<const OopParser>>> captureHistory_unlocked() const;
+
+    /**
+     * @brief Write captured history to a journal file
+     * @param file Open output file
+     * @param history Output of captureHistory_unlocked()
+     * @param currentVersion Version rolled back to (a rollback record follows if not the latest)
+     * @param options Journal settings captured together with the history
+     * @param bytes Set to the number of bytes written
+     * @return True if successful
+     */
+    static bool writeJournalHistory(FILE* file,
+        const std::vector<std::pair<VersionEntry, std::shared_ptr<const OopParser>>>& history,
+        size_t currentVersion, const JournalOptions& options, size_t& bytes);
+
+    /**
+     * @brief Body of the background compaction thread
+     * @return True if the journal was replaced
+     */
+    bool runCompaction();
+
+    /**
+     * @brief Launch the compaction thread (assumes lock is held)
+     * @return True if started
+     */
+    bool startCompaction_unlocked();
+
+    /**
+     * @brief Find position of a version in history (assumes lock is held)
+     * @param version Version number
+     * @return Index into versions_ or versions_.size() if not found
+     */
+    size_t findVersionIndex_unlocked(size_t version) const;
+
+    /**
+     * @brief Reconstruct configuration of a history entry (assumes lock is held)
+     * @param index Index into versions_
+     * @return Full configuration for that entry
+     */
+    std::shared_ptr<OopParser> materialize_unlocked(size_t index) const;
+
+    /**
+     * @brief Estimate memory introduced by a history entry (assumes lock is held)
+     * @param entry History entry
+     * @param previous Configuration of the preceding entry; sections shared
+     *        with it are not counted (nullptr counts every section)
+     * @return Approximate size in bytes
+     */
+    size_t entryBytes_unlocked(const VersionEntry& entry, const OopParser* previous) const;
+
+    /**
+     * @brief Drop oldest versions until history limits hold (assumes lock is held)
+     */
+    void evictHistory_unlocked();
 
     /**
      * @brief Generate timestamp string (ISO 8601)
@@ -1531,6 +3488,114 @@ private:
     bool rollback_unlocked(size_t version);
 };
 
+// ============ OopParser template implementations ============
+
+template <typename Predicate, typename>
+std::vector<ConfigParameter> OopParser::getParametersWhere(Predicate&& predicate) const {
+    std::vector<ConfigParameter> results;
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+
+    for (const auto& section : sections_) {
+        for (const auto& [key, param] : section->parameters) {
+            if (predicate(param)) {
+                results.push_back(param);
+            }
+        }
+    }
+
+    return results;
+}
+
+template <typename Predicate, typename>
+ConfigParameter* OopParser::findWhere(Predicate&& predicate) {
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+
+    for (auto& section : sections_) {
+        for (const auto& [key, param] : section->parameters) {
+            if (predicate(param)) {
+                return lendSection(section).getParameter(key);
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+template <typename Predicate, typename>
+const ConfigParameter* OopParser::findWhere(Predicate&& predicate) const {
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+
+    for (const auto& section : sections_) {
+        for (const auto& [key, param] : section->parameters) {
+            if (predicate(param)) {
+                return &param;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+template <typename Predicate>
+std::vector<ConfigParameter> OopParser::getParametersWhereParallel(Predicate&& predicate,
+                                                                   size_t threads) const {
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    const std::vector<size_t> bounds = partitionSections_unlocked(threads);
+    std::vector<std::vector<const ConfigParameter*>> matches(bounds.size() - 1);
+
+    runParallel(matches.size(), [&](size_t chunk) {
+        for (size_t s = bounds[chunk]; s < bounds[chunk + 1]; ++s) {
+            for (const auto& [key, param] : sections_[s]->parameters) {
+                if (predicate(param)) {
+                    matches[chunk].push_back(&param);
+                }
+            }
+        }
+    });
+
+    size_t total = 0;
+    for (const auto& chunk : matches) {
+        total += chunk.size();
+    }
+    std::vector<ConfigParameter> results;
+    results.reserve(total);
+    for (const auto& chunk : matches) {
+        for (const ConfigParameter* param : chunk) {
+            results.push_back(*param);
+        }
+    }
+
+    return results;
+}
+
+template <typename Predicate>
+const ConfigParameter* OopParser::findWhereParallel(Predicate&& predicate, size_t threads) const {
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    const std::vector<size_t> bounds = partitionSections_unlocked(threads);
+    std::vector<const ConfigParameter*> found(bounds.size() - 1, nullptr);
+    std::atomic<size_t> firstChunk(found.size());
+
+    runParallel(found.size(), [&](size_t chunk) {
+        for (size_t s = bounds[chunk]; s < bounds[chunk + 1]; ++s) {
+            for (const auto& [key, param] : sections_[s]->parameters) {
+                if (firstChunk.load(std::memory_order_relaxed) < chunk) {
+                    return;  // An earlier chunk already has the answer
+                }
+                if (predicate(param)) {
+                    found[chunk] = &param;
+                    size_t current = firstChunk.load();
+                    while (chunk < current && !firstChunk.compare_exchange_weak(current, chunk)) {
+                    }
+                    return;
+                }
+            }
+        }
+    });
+
+    size_t chunk = firstChunk.load();
+    return chunk < found.size() ? found[chunk] : nullptr;
+}
+
 /**
  * @brief Convert OOP file to JSON
  * @param oopFilepath Path to OOP file
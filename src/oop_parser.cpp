@@ -20,6 +20,22 @@
 #include <cmath>
 #include <cstdio>
 #include <set>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <filesystem>
+#include <chrono>
+#include <condition_variable>
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define IOC_CONFIG_X86_SIMD 1
+#endif
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
 
 // Include nlohmann/json for JSON support
 #include <nlohmann/json.hpp>
@@ -78,7 +94,61 @@ std::vector<std::string> ConfigParameter::asStringVector() const {
 
 // ============ RangeConstraint Implementation ============
 
+namespace {
+
+/// Interned RangeConstraint parses, keyed by expression text
+struct ConstraintCache {
+    static constexpr size_t kMaxEntries = 4096;     // Cleared when full; schemas repeat few expressions
+    std::mutex mutex;
+    std::unordered_map<std::string, RangeConstraint> entries;
+};
+
+ConstraintCache& constraintCache() {
+    static ConstraintCache cache;
+    return cache;
+}
+
+}  // namespace
+
 bool RangeConstraint::parseExpression(const std::string& expr) {
+    ConstraintCache& cache = constraintCache();
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        auto it = cache.entries.find(expr);
+        if (it != cache.entries.end()) {
+            *this = it->second;
+            return true;
+        }
+    }
+    
+    RangeConstraint parsed;
+    if (!parsed.parseExpressionUncached(expr)) {
+        constraint_expr = expr;
+        return false;
+    }
+    *this = parsed;
+    
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    if (cache.entries.size() >= ConstraintCache::kMaxEntries) {
+        cache.entries.clear();
+    }
+    cache.entries.emplace(expr, std::move(parsed));
+    return true;
+}
+
+void RangeConstraint::clearExpressionCache() {
+    ConstraintCache& cache = constraintCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.entries.clear();
+}
+
+size_t RangeConstraint::getExpressionCacheSize() {
+    ConstraintCache& cache = constraintCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    return cache.entries.size();
+}
+
+bool RangeConstraint::parseExpressionUncached(const std::string& expr) {
     constraint_expr = expr;
     std::string trimmed = expr;
     // Remove spaces
@@ -212,18 +282,98 @@ bool RangeConstraint::parseExpression(const std::string& expr) {
     return false;
 }
 
-bool RangeConstraint::isSatisfied(double value) const {
-    if (!enabled) return true;
+std::string RangeConstraint::toString() const {
+    if (!enabled) return "no constraint";
+    return constraint_expr;
+}
 
-    bool min_ok = min_inclusive ? (value >= min_value) : (value > min_value);
-    bool max_ok = max_inclusive ? (value <= max_value) : (value < max_value);
+namespace {
 
-    return min_ok && max_ok;
+#ifdef IOC_CONFIG_X86_SIMD
+// Append the lanes of a comparison mask that failed, offset by base
+inline void appendViolationLanes(int ok_mask, int lanes, size_t base, std::vector<size_t>& violations) {
+    int bad = ~ok_mask & ((1 << lanes) - 1);
+    for (int lane = 0; bad != 0; ++lane, bad >>= 1) {
+        if (bad & 1) {
+            violations.push_back(base + lane);
+        }
+    }
 }
 
-std::string RangeConstraint::toString() const {
-    if (!enabled) return "no constraint";
-    return constraint_expr;
+// Two values per step; returns the number of values processed
+size_t findViolationsSse2(const RangeConstraint& c, const double* values, size_t count,
+                          std::vector<size_t>& violations) {
+    const __m128d lo = _mm_set1_pd(c.min_value);
+    const __m128d hi = _mm_set1_pd(c.max_value);
+    const __m128d lo_inclusive = _mm_castsi128_pd(_mm_set1_epi64x(c.min_inclusive ? -1 : 0));
+    const __m128d hi_inclusive = _mm_castsi128_pd(_mm_set1_epi64x(c.max_inclusive ? -1 : 0));
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m128d v = _mm_loadu_pd(values + i);
+        __m128d min_ok = _mm_or_pd(_mm_cmpgt_pd(v, lo), _mm_and_pd(_mm_cmpeq_pd(v, lo), lo_inclusive));
+        __m128d max_ok = _mm_or_pd(_mm_cmplt_pd(v, hi), _mm_and_pd(_mm_cmpeq_pd(v, hi), hi_inclusive));
+        int ok = _mm_movemask_pd(_mm_and_pd(min_ok, max_ok));
+        if (ok != 0x3) {
+            appendViolationLanes(ok, 2, i, violations);
+        }
+    }
+    return i;
+}
+
+#if defined(__GNUC__)
+// Four values per step, compiled for AVX and only called when the CPU has it
+__attribute__((target("avx")))
+size_t findViolationsAvx(const RangeConstraint& c, const double* values, size_t count,
+                         std::vector<size_t>& violations) {
+    const __m256d lo = _mm256_set1_pd(c.min_value);
+    const __m256d hi = _mm256_set1_pd(c.max_value);
+    const __m256d lo_inclusive = _mm256_castsi256_pd(_mm256_set1_epi64x(c.min_inclusive ? -1 : 0));
+    const __m256d hi_inclusive = _mm256_castsi256_pd(_mm256_set1_epi64x(c.max_inclusive ? -1 : 0));
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d v = _mm256_loadu_pd(values + i);
+        __m256d min_ok = _mm256_or_pd(_mm256_cmp_pd(v, lo, _CMP_GT_OQ),
+                                      _mm256_and_pd(_mm256_cmp_pd(v, lo, _CMP_EQ_OQ), lo_inclusive));
+        __m256d max_ok = _mm256_or_pd(_mm256_cmp_pd(v, hi, _CMP_LT_OQ),
+                                      _mm256_and_pd(_mm256_cmp_pd(v, hi, _CMP_EQ_OQ), hi_inclusive));
+        int ok = _mm256_movemask_pd(_mm256_and_pd(min_ok, max_ok));
+        if (ok != 0xF) {
+            appendViolationLanes(ok, 4, i, violations);
+        }
+    }
+    return i;
+}
+
+bool cpuHasAvx() {
+    static const bool has_avx = __builtin_cpu_supports("avx");
+    return has_avx;
+}
+#endif
+#endif
+
+}  // namespace
+
+size_t RangeConstraint::findViolations(const double* values, size_t count,
+                                       std::vector<size_t>& violations) const {
+    if (!enabled) {
+        return 0;
+    }
+    const size_t before = violations.size();
+    size_t done = 0;
+#ifdef IOC_CONFIG_X86_SIMD
+#if defined(__GNUC__)
+    if (cpuHasAvx()) {
+        done = findViolationsAvx(*this, values, count, violations);
+    } else
+#endif
+    done = findViolationsSse2(*this, values, count, violations);
+#endif
+    for (size_t i = done; i < count; ++i) {
+        if (!isSatisfied(values[i])) {
+            violations.push_back(i);
+        }
+    }
+    return violations.size() - before;
 }
 
 // ============ ParameterSpec Implementation ============
@@ -244,149 +394,789 @@ bool ParameterSpec::isValid(const std::string& value) const {
     }
 }
 
-// ============ OopParser Implementation (extended) ============
-
-std::string ConfigSectionData::sectionTypeToString(SectionType type) {
-    switch (type) {
-        case SectionType::OBJECT: return "object";
-        case SectionType::PROPAGATION: return "propagation";
-        case SectionType::ASTEROIDS: return "asteroids";
-        case SectionType::TIME: return "time";
-        case SectionType::SEARCH: return "search";
-        case SectionType::DATABASE: return "database";
-        case SectionType::GAIA: return "gaia";
-        case SectionType::OBSERVER: return "observer";
-        case SectionType::OUTPUT: return "output";
-        case SectionType::PERFORMANCE: return "performance";
-        case SectionType::OCCULTATION: return "occultation";
-        case SectionType::FILTERS: return "filters";
-        default: return "unknown";
+bool ParameterSpec::findArrayViolations(const std::string& value, std::vector<size_t>& violations) const {
+    violations.clear();
+    
+    if (!allowed_values.empty()) {
+        std::string body = OopParser::trim(value);
+        if (body.size() >= 2 && body.front() == '[' && body.back() == ']') {
+            body = body.substr(1, body.size() - 2);
+        }
+        std::vector<std::string> elements = OopParser::split(body, ',');
+        for (size_t i = 0; i < elements.size(); ++i) {
+            if (std::find(allowed_values.begin(), allowed_values.end(), elements[i]) == allowed_values.end()) {
+                violations.push_back(i);
+            }
+        }
+        return violations.empty();
     }
+    
+    std::vector<double> values;
+    OopParser::parseNumericArray(value, values);
+    constraint.findViolations(values.data(), values.size(), violations);
+    return violations.empty();
 }
 
-SectionType ConfigSectionData::stringToSectionType(const std::string& name) {
-    std::string lower_name = name;
-    std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), ::tolower);
+// ============ CrossConstraint Implementation ============
+
+/// Recursive-descent compiler emitting CrossConstraint bytecode
+class CrossConstraintCompiler {
+public:
+    using Op = CrossConstraint::Op;
     
-    if (lower_name == "object") return SectionType::OBJECT;
-    if (lower_name == "propag" || lower_name == "propagation") return SectionType::PROPAGATION;
-    if (lower_name == "asteroids") return SectionType::ASTEROIDS;
-    if (lower_name == "time") return SectionType::TIME;
-    if (lower_name == "search") return SectionType::SEARCH;
-    if (lower_name == "database") return SectionType::DATABASE;
-    if (lower_name == "gaia") return SectionType::GAIA;
-    if (lower_name == "observer") return SectionType::OBSERVER;
-    if (lower_name == "output") return SectionType::OUTPUT;
-    if (lower_name == "performance") return SectionType::PERFORMANCE;
-    if (lower_name == "occultation") return SectionType::OCCULTATION;
-    if (lower_name == "filters") return SectionType::FILTERS;
+    CrossConstraintCompiler(const std::string& text, CrossConstraint& out) : text_(text), out_(out) {}
     
-    return SectionType::UNKNOWN;
-}
+    bool compile(std::string& error) {
+        if (!parseOr(error)) {
+            return false;
+        }
+        skipBlanks();
+        if (pos_ != text_.size()) {
+            error = "Unexpected character at position " + std::to_string(pos_);
+            return false;
+        }
+        return true;
+    }
 
-ConfigParameter* ConfigSectionData::getParameter(const std::string& key) {
-    auto it = parameters.find(key);
-    return it != parameters.end() ? &it->second : nullptr;
+private:
+    const std::string& text_;
+    CrossConstraint& out_;
+    size_t pos_ = 0;
+    size_t depth_ = 0;      // Operand stack depth after the code emitted so far
+    
+    void skipBlanks() {
+        while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_]))) {
+            ++pos_;
+        }
+    }
+    
+    // Consume a symbol or a case-insensitive keyword (keywords must end at a word boundary)
+    bool accept(const char* symbol, const char* keyword = nullptr) {
+        skipBlanks();
+        size_t length = std::strlen(symbol);
+        if (text_.compare(pos_, length, symbol) == 0) {
+            pos_ += length;
+            return true;
+        }
+        if (keyword) {
+            length = std::strlen(keyword);
+            if (pos_ + length <= text_.size() &&
+                equalsLowerAt(text_, pos_, keyword, length) &&
+                (pos_ + length == text_.size() || !isWordChar(text_[pos_ + length]))) {
+                pos_ += length;
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    // Characters that continue a keyword into a reference ("not_used.x", "and.x")
+    static bool isWordChar(char c) {
+        return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '.';
+    }
+    
+    static bool equalsLowerAt(const std::string& text, size_t pos, const char* word, size_t length) {
+        for (size_t i = 0; i < length; ++i) {
+            if (std::tolower(static_cast<unsigned char>(text[pos + i])) != std::tolower(word[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    bool emit(Op op, std::string& error, double constant = 0.0, size_t ref = 0) {
+        CrossConstraint::Instruction instruction;
+        instruction.op = op;
+        instruction.constant = constant;
+        instruction.ref = ref;
+        out_.code_.push_back(instruction);
+        
+        if (op == Op::CONST || op == Op::REF) {
+            if (++depth_ > CrossConstraint::kMaxStack) {
+                error = "Expression too deeply nested";
+                return false;
+            }
+        } else if (op != Op::NEG && op != Op::NOT) {
+            --depth_;
+        }
+        return true;
+    }
+    
+    bool parseOr(std::string& error) {
+        if (!parseAnd(error)) return false;
+        while (accept("||", "or")) {
+            if (!parseAnd(error) || !emit(Op::OR, error)) return false;
+        }
+        return true;
+    }
+    
+    bool parseAnd(std::string& error) {
+        if (!parseNot(error)) return false;
+        while (accept("&&", "and")) {
+            if (!parseNot(error) || !emit(Op::AND, error)) return false;
+        }
+        return true;
+    }
+    
+    bool parseNot(std::string& error) {
+        skipBlanks();
+        if (text_.compare(pos_, 2, "!=") != 0 && accept("!", "not")) {
+            return parseNot(error) && emit(Op::NOT, error);
+        }
+        return parseCompare(error);
+    }
+    
+    bool parseCompare(std::string& error) {
+        if (!parseSum(error)) return false;
+        Op op;
+        if (accept("<=")) op = Op::LE;
+        else if (accept(">=")) op = Op::GE;
+        else if (accept("==")) op = Op::EQ;
+        else if (accept("!=")) op = Op::NE;
+        else if (accept("<")) op = Op::LT;
+        else if (accept(">")) op = Op::GT;
+        else if (accept("=")) op = Op::EQ;
+        else return true;
+        return parseSum(error) && emit(op, error);
+    }
+    
+    bool parseSum(std::string& error) {
+        if (!parseProduct(error)) return false;
+        while (true) {
+            Op op;
+            if (accept("+")) op = Op::ADD;
+            else if (accept("-")) op = Op::SUB;
+            else return true;
+            if (!parseProduct(error) || !emit(op, error)) return false;
+        }
+    }
+    
+    bool parseProduct(std::string& error) {
+        if (!parseUnary(error)) return false;
+        while (true) {
+            Op op;
+            if (accept("*")) op = Op::MUL;
+            else if (accept("/")) op = Op::DIV;
+            else return true;
+            if (!parseUnary(error) || !emit(op, error)) return false;
+        }
+    }
+    
+    bool parseUnary(std::string& error) {
+        if (accept("-")) {
+            return parseUnary(error) && emit(Op::NEG, error);
+        }
+        if (accept("(")) {
+            if (!parseOr(error)) return false;
+            if (!accept(")")) {
+                error = "Expected ')' at position " + std::to_string(pos_);
+                return false;
+            }
+            return true;
+        }
+        
+        skipBlanks();
+        if (pos_ == text_.size()) {
+            error = "Unexpected end of expression";
+            return false;
+        }
+        unsigned char c = static_cast<unsigned char>(text_[pos_]);
+        if (std::isdigit(c) || c == '.') {
+            const char* begin = text_.c_str() + pos_;
+            char* end = nullptr;
+            double number = std::strtod(begin, &end);
+            if (end == begin) {
+                error = "Invalid number at position " + std::to_string(pos_);
+                return false;
+            }
+            pos_ += end - begin;
+            return emit(Op::CONST, error, number);
+        }
+        if (std::isalpha(c) || c == '_') {
+            size_t start = pos_;
+            while (pos_ < text_.size() && (std::isalnum(static_cast<unsigned char>(text_[pos_])) ||
+                                           text_[pos_] == '_' || text_[pos_] == '.')) {
+                ++pos_;
+            }
+            std::string name = text_.substr(start, pos_ - start);
+            size_t dot = name.find('.');
+            if (dot == std::string::npos || dot == 0 || dot + 1 == name.size()) {
+                error = "Expected section.key reference at position " + std::to_string(start);
+                return false;
+            }
+            CrossConstraint::Reference ref(name.substr(0, dot), name.substr(dot + 1));
+            auto& refs = out_.references_;
+            size_t index = std::find(refs.begin(), refs.end(), ref) - refs.begin();
+            if (index == refs.size()) {
+                refs.push_back(std::move(ref));
+            }
+            return emit(Op::REF, error, 0.0, index);
+        }
+        error = "Unexpected character at position " + std::to_string(pos_);
+        return false;
+    }
+};
+
+CrossConstraint::CrossConstraint(const std::string& expression) : expression_(expression) {
+    CrossConstraintCompiler compiler(expression_, *this);
+    if (!compiler.compile(error_)) {
+        references_.clear();
+        code_.clear();
+    }
 }
 
-const ConfigParameter* ConfigSectionData::getParameter(const std::string& key) const {
-    auto it = parameters.find(key);
-    return it != parameters.end() ? &it->second : nullptr;
+const std::string& CrossConstraint::getExpression() const {
+    return expression_;
 }
 
-// ============ OopParser Implementation ============
+bool CrossConstraint::isValid() const {
+    return error_.empty();
+}
 
-OopParser::OopParser() : lastError_("") {}
+const std::string& CrossConstraint::getError() const {
+    return error_;
+}
 
-OopParser::OopParser(const std::string& filepath) : lastError_("") {
-    loadFromOop(filepath);
+const std::vector<CrossConstraint::Reference>& CrossConstraint::getReferences() const {
+    return references_;
 }
 
-bool OopParser::loadFromOop(const std::string& filepath) {
-    std::ifstream file(filepath);
-    if (!file.is_open()) {
-        lastError_ = "Cannot open file: " + filepath;
+bool CrossConstraint::evaluate(const double* values) const {
+    if (!error_.empty()) {
         return false;
     }
-
-    std::lock_guard<std::mutex> lock(sectionsMutex_);
     
-    clear();
-    std::string line;
-    ConfigSectionData currentSection;
-    currentSection.type = SectionType::UNKNOWN;
-
-    while (std::getline(file, line)) {
-        line = trim(line);
-
-        // Skip empty lines and comments
-        if (line.empty() || isComment(line)) {
-            continue;
+    double stack[kMaxStack];
+    size_t top = 0;
+    for (const Instruction& instruction : code_) {
+        switch (instruction.op) {
+            case Op::CONST: stack[top++] = instruction.constant; continue;
+            case Op::REF:   stack[top++] = values[instruction.ref]; continue;
+            case Op::NEG:   stack[top - 1] = -stack[top - 1]; continue;
+            case Op::NOT:   stack[top - 1] = stack[top - 1] == 0.0; continue;
+            default: break;
         }
-
-        // Check if this is a new section
-        std::string sectionName = isSection(line);
-        if (!sectionName.empty()) {
-            // Save previous section if it has content
-            if (!currentSection.parameters.empty()) {
-                sections_.push_back(currentSection);
-            }
-            // Start new section
-            currentSection.name = sectionName;
-            currentSection.type = ConfigSectionData::stringToSectionType(sectionName);
-            currentSection.parameters.clear();
-        } else {
-            // Parse parameter
-            if (!parseLine(line, currentSection)) {
-                lastError_ = "Error parsing line: " + line;
-                return false;
-            }
+        double rhs = stack[--top];
+        double& lhs = stack[top - 1];
+        switch (instruction.op) {
+            case Op::ADD: lhs = lhs + rhs; break;
+            case Op::SUB: lhs = lhs - rhs; break;
+            case Op::MUL: lhs = lhs * rhs; break;
+            case Op::DIV: lhs = lhs / rhs; break;
+            case Op::LT:  lhs = lhs < rhs; break;
+            case Op::LE:  lhs = lhs <= rhs; break;
+            case Op::GT:  lhs = lhs > rhs; break;
+            case Op::GE:  lhs = lhs >= rhs; break;
+            case Op::EQ:  lhs = lhs == rhs; break;
+            case Op::NE:  lhs = lhs != rhs; break;
+            case Op::AND: lhs = (lhs != 0.0) && (rhs != 0.0); break;
+            case Op::OR:  lhs = (lhs != 0.0) || (rhs != 0.0); break;
+            default: break;
         }
     }
-
-    // Save last section
-    if (!currentSection.parameters.empty()) {
-        sections_.push_back(currentSection);
-    }
-
-    file.close();
-    return true;
+    return top == 1 && stack[0] != 0.0;
 }
 
-bool OopParser::saveToOop(const std::string& filepath) const {
-    std::ofstream file(filepath);
-    if (!file.is_open()) {
-        lastError_ = "Cannot open file for writing: " + filepath;
+bool CrossConstraint::asBound(size_t& ref, Op& op, double& bound) const {
+    if (code_.size() != 3) {
+        return false;
+    }
+    op = code_[2].op;
+    if (op != Op::LT && op != Op::LE && op != Op::GT && op != Op::GE) {
         return false;
     }
+    if (code_[0].op == Op::REF && code_[1].op == Op::CONST) {
+        ref = code_[0].ref;
+        bound = code_[1].constant;
+        return true;
+    }
+    if (code_[0].op == Op::CONST && code_[1].op == Op::REF) {
+        // "5 < a.b" is "a.b > 5"
+        ref = code_[1].ref;
+        bound = code_[0].constant;
+        op = op == Op::LT ? Op::GT : op == Op::LE ? Op::GE : op == Op::GT ? Op::LT : Op::LE;
+        return true;
+    }
+    return false;
+}
 
-    for (const auto& section : sections_) {
-        // Write section header
-        file << section.name << ".\n";
+// ============ CompiledSchema Implementation ============
 
-        // Write parameters
-        for (const auto& [key, param] : section.parameters) {
-            file << "\t" << key << " = " << param.value << "\n";
+CompiledSchema::CompiledSchema(const ConfigSchema& schema)
+    : name_(schema.name), constraints_(schema.constraints) {
+    sections_.reserve(schema.sections.size());
+    for (const auto& [section_name, section_spec] : schema.sections) {
+        SectionRule section;
+        section.name = section_name;
+        section.required = section_spec.required;
+        section.params.reserve(section_spec.params.size());
+        
+        for (const auto& [param_key, param_spec] : section_spec.params) {
+            ParameterRule rule;
+            rule.key = param_key;
+            rule.required = param_spec.required;
+            rule.hasAllowedValues = !param_spec.allowed_values.empty();
+            rule.allowedValues.insert(param_spec.allowed_values.begin(), param_spec.allowed_values.end());
+            rule.hasRange = param_spec.constraint.enabled;
+            rule.minValue = param_spec.constraint.min_value;
+            rule.maxValue = param_spec.constraint.max_value;
+            rule.minInclusive = param_spec.constraint.min_inclusive;
+            rule.maxInclusive = param_spec.constraint.max_inclusive;
+            rule.constraintText = param_spec.constraint.toString();
+            rule.type = param_spec.type;
+            rule.defaultValue = param_spec.default_value;
+            section.paramIndex[param_key] = section.params.size();
+            section.params.push_back(std::move(rule));
         }
-
-        file << "\n";
+        
+        sectionIndex_[section_name] = sections_.size();
+        sections_.push_back(std::move(section));
     }
+}
 
-    file.close();
-    return true;
+const std::string& CompiledSchema::getName() const {
+    return name_;
 }
 
-bool OopParser::loadFromJson(const std::string& filepath) {
-    std::ifstream file(filepath);
-    if (!file.is_open()) {
-        lastError_ = "Cannot open JSON file: " + filepath;
-        return false;
+bool CompiledSchema::ParameterRule::check(const std::string& value) const {
+    if (hasAllowedValues) {
+        return allowedValues.count(value) > 0;
+    }
+    
+    // Numeric prefix as std::stod reads it; out-of-range counts as non-numeric
+    const char* begin = value.c_str();
+    char* end = nullptr;
+    errno = 0;
+    double number = std::strtod(begin, &end);
+    if (end == begin || errno == ERANGE) {
+        return !hasRange;
+    }
+    if (!hasRange) {
+        return true;
     }
+    
+    bool min_ok = minInclusive ? (number >= minValue) : (number > minValue);
+    bool max_ok = maxInclusive ? (number <= maxValue) : (number < maxValue);
+    return min_ok && max_ok;
+}
 
-    try {
-        json j;
-        file >> j;
-        file.close();
+bool CompiledSchema::isValueValid(const std::string& section, const std::string& key,
+                                  const std::string& value) const {
+    auto section_it = sectionIndex_.find(section);
+    if (section_it == sectionIndex_.end()) {
+        return true;
+    }
+    const SectionRule& rule = sections_[section_it->second];
+    auto param_it = rule.paramIndex.find(key);
+    return param_it == rule.paramIndex.end() || rule.params[param_it->second].check(value);
+}
+
+// ============ CompiledJsonSchema Implementation ============
+
+namespace {
+
+// Human-readable list of accepted JSON types
+std::string jsonTypeNames(uint8_t types) {
+    static const char* names[] = {"object", "array", "string", "number", "integer", "boolean", "null"};
+    std::string result;
+    for (int bit = 0; bit < 7; ++bit) {
+        if (types & (1u << bit)) {
+            result += result.empty() ? "" : " or ";
+            result += names[bit];
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+CompiledJsonSchema::CompiledJsonSchema(const nlohmann::json& schema) {
+    if (compileNode(schema, "#") == std::string::npos) {
+        nodes_.clear();
+        return;
+    }
+    
+    if (schema.is_object() && schema.contains("constraints")) {
+        const json& constraints = schema["constraints"];
+        if (!constraints.is_array()) {
+            error_ = "#/constraints: must be an array";
+            return;
+        }
+        for (const auto& expression : constraints) {
+            if (!expression.is_string()) {
+                error_ = "#/constraints: entries must be strings";
+                return;
+            }
+            CrossConstraint constraint(expression.get<std::string>());
+            if (!constraint.isValid()) {
+                error_ = "#/constraints: " + constraint.getError() + " in '" + constraint.getExpression() + "'";
+                return;
+            }
+            constraints_.push_back(std::move(constraint));
+        }
+    }
+}
+
+bool CompiledJsonSchema::isValid() const {
+    return error_.empty();
+}
+
+const std::string& CompiledJsonSchema::getError() const {
+    return error_;
+}
+
+size_t CompiledJsonSchema::compileNode(const nlohmann::json& schema, const std::string& path) {
+    size_t index = nodes_.size();
+    nodes_.emplace_back();
+    if (schema.is_boolean()) {
+        nodes_[index].rejectAll = !schema.get<bool>();
+        return index;
+    }
+    if (!schema.is_object()) {
+        error_ = path + ": schema must be an object or a boolean";
+        return std::string::npos;
+    }
+    
+    Node node;
+    auto number = [&](const char* keyword, double& out) {
+        auto it = schema.find(keyword);
+        if (it == schema.end()) {
+            return true;
+        }
+        if (!it->is_number()) {
+            error_ = path + "/" + keyword + ": must be a number";
+            return false;
+        }
+        out = it->get<double>();
+        return true;
+    };
+    if (!number("minimum", node.minimum) || !number("maximum", node.maximum) ||
+        !number("exclusiveMinimum", node.exclusiveMinimum) || !number("exclusiveMaximum", node.exclusiveMaximum)) {
+        return std::string::npos;
+    }
+    
+    if (auto it = schema.find("type"); it != schema.end()) {
+        static const std::pair<const char*, uint8_t> type_bits[] = {
+            {"object", TYPE_OBJECT}, {"array", TYPE_ARRAY}, {"string", TYPE_STRING}, {"number", TYPE_NUMBER},
+            {"integer", TYPE_INTEGER}, {"boolean", TYPE_BOOLEAN}, {"null", TYPE_NULL}};
+        std::vector<json> names = it->is_array() ? it->get<std::vector<json>>() : std::vector<json>{*it};
+        for (const auto& name : names) {
+            uint8_t bit = 0;
+            for (const auto& [type_name, type_bit] : type_bits) {
+                if (name.is_string() && name.get_ref<const std::string&>() == type_name) {
+                    bit = type_bit;
+                }
+            }
+            if (bit == 0) {
+                error_ = path + "/type: unknown type " + name.dump();
+                return std::string::npos;
+            }
+            node.types |= bit;
+        }
+    }
+    
+    if (auto it = schema.find("enum"); it != schema.end()) {
+        if (!it->is_array()) {
+            error_ = path + "/enum: must be an array";
+            return std::string::npos;
+        }
+        node.hasEnum = true;
+        node.enumValues = it->get<std::vector<json>>();
+    }
+    
+    if (auto it = schema.find("required"); it != schema.end()) {
+        if (!it->is_array()) {
+            error_ = path + "/required: must be an array";
+            return std::string::npos;
+        }
+        for (const auto& name : *it) {
+            if (!name.is_string()) {
+                error_ = path + "/required: entries must be strings";
+                return std::string::npos;
+            }
+            node.required.push_back(name.get<std::string>());
+        }
+    }
+    
+    if (auto it = schema.find("properties"); it != schema.end()) {
+        if (!it->is_object()) {
+            error_ = path + "/properties: must be an object";
+            return std::string::npos;
+        }
+        for (const auto& [name, child] : it->items()) {
+            size_t child_index = compileNode(child, path + "/properties/" + name);
+            if (child_index == std::string::npos) {
+                return std::string::npos;
+            }
+            node.properties[name] = child_index;
+        }
+    }
+    
+    if (auto it = schema.find("additionalProperties"); it != schema.end()) {
+        if (it->is_boolean()) {
+            node.additionalAllowed = it->get<bool>();
+        } else {
+            node.additionalSchema = compileNode(*it, path + "/additionalProperties");
+            if (node.additionalSchema == std::string::npos) {
+                return std::string::npos;
+            }
+        }
+    }
+    
+    nodes_[index] = std::move(node);
+    return index;
+}
+
+// Parse a whole value as double (defined with the typed path getters)
+static bool parseDoubleValue(const std::string& text, double& value);
+
+void CompiledJsonSchema::checkValue(const Node& node, const std::string& section, const ConfigParameter& param,
+                                    std::vector<std::string>& errors) {
+    auto fail = [&](const std::string& message) {
+        errors.push_back("/" + section + "/" + param.key + ": " + message);
+    };
+    if (node.rejectAll) {
+        fail("no value is allowed");
+        return;
+    }
+    
+    // Type the value as toJson() would; every OOP value is also text
+    uint8_t actual = TYPE_STRING;
+    double number = 0.0;
+    bool boolean = false;
+    if (param.type == "bool") {
+        std::string lower = param.value;
+        std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+        boolean = lower == ".true." || lower == "true" || lower == "1";
+        actual |= TYPE_BOOLEAN;
+    } else if (param.type == "array") {
+        actual |= TYPE_ARRAY;
+    } else if (parseDoubleValue(param.value, number)) {
+        actual |= TYPE_NUMBER;
+        if (std::isfinite(number) && std::floor(number) == number) {
+            actual |= TYPE_INTEGER;
+        }
+    }
+    
+    if (node.types != 0 && (node.types & actual) == 0) {
+        fail("expected " + jsonTypeNames(node.types) + ", got '" + param.value + "'");
+        return;
+    }
+    
+    if (node.hasEnum) {
+        std::string_view text = param.value;
+        if (text.size() >= 2 && text.front() == '\'' && text.back() == '\'') {
+            text = text.substr(1, text.size() - 2);
+        }
+        bool found = false;
+        for (const auto& candidate : node.enumValues) {
+            found = (candidate.is_string() && candidate.get_ref<const std::string&>() == text) ||
+                    ((actual & TYPE_NUMBER) && candidate.is_number() && candidate.get<double>() == number) ||
+                    ((actual & TYPE_BOOLEAN) && candidate.is_boolean() && candidate.get<bool>() == boolean);
+            if (found) {
+                break;
+            }
+        }
+        if (!found) {
+            fail("value '" + param.value + "' is not one of the enum values");
+        }
+    }
+    
+    if (actual & TYPE_NUMBER) {
+        if (number < node.minimum) {
+            fail(param.value + " is less than minimum " + json(node.minimum).dump());
+        }
+        if (number > node.maximum) {
+            fail(param.value + " is greater than maximum " + json(node.maximum).dump());
+        }
+        if (number <= node.exclusiveMinimum) {
+            fail(param.value + " is not greater than exclusiveMinimum " + json(node.exclusiveMinimum).dump());
+        }
+        if (number >= node.exclusiveMaximum) {
+            fail(param.value + " is not less than exclusiveMaximum " + json(node.exclusiveMaximum).dump());
+        }
+    }
+}
+
+std::string ValidationIssue::toString() const {
+    switch (kind) {
+        case Kind::MISSING_SECTION:
+            return "Missing required section: " + section;
+        case Kind::MISSING_PARAMETER:
+            return "Missing required parameter '" + key + "' in section '" + section + "'";
+        case Kind::INVALID_VALUE:
+            return "Parameter '" + key + "' in section '" + section + "' failed validation: " +
+                   constraint + " (value: " + value + ")";
+        case Kind::UNKNOWN_SECTION:
+            return "Unknown section: " + section;
+        case Kind::UNKNOWN_PARAMETER:
+            return "Unknown parameter '" + key + "' in section '" + section + "'";
+        case Kind::CONSTRAINT_VIOLATED:
+            return "Constraint violated: " + constraint;
+    }
+    return "";
+}
+
+// ============ OopParser Implementation (extended) ============
+
+std::string ConfigSectionData::sectionTypeToString(SectionType type) {
+    switch (type) {
+        case SectionType::OBJECT: return "object";
+        case SectionType::PROPAGATION: return "propagation";
+        case SectionType::ASTEROIDS: return "asteroids";
+        case SectionType::TIME: return "time";
+        case SectionType::SEARCH: return "search";
+        case SectionType::DATABASE: return "database";
+        case SectionType::GAIA: return "gaia";
+        case SectionType::OBSERVER: return "observer";
+        case SectionType::OUTPUT: return "output";
+        case SectionType::PERFORMANCE: return "performance";
+        case SectionType::OCCULTATION: return "occultation";
+        case SectionType::FILTERS: return "filters";
+        default: return "unknown";
+    }
+}
+
+SectionType ConfigSectionData::stringToSectionType(const std::string& name) {
+    std::string lower_name = name;
+    std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), ::tolower);
+    
+    if (lower_name == "object") return SectionType::OBJECT;
+    if (lower_name == "propag" || lower_name == "propagation") return SectionType::PROPAGATION;
+    if (lower_name == "asteroids") return SectionType::ASTEROIDS;
+    if (lower_name == "time") return SectionType::TIME;
+    if (lower_name == "search") return SectionType::SEARCH;
+    if (lower_name == "database") return SectionType::DATABASE;
+    if (lower_name == "gaia") return SectionType::GAIA;
+    if (lower_name == "observer") return SectionType::OBSERVER;
+    if (lower_name == "output") return SectionType::OUTPUT;
+    if (lower_name == "performance") return SectionType::PERFORMANCE;
+    if (lower_name == "occultation") return SectionType::OCCULTATION;
+    if (lower_name == "filters") return SectionType::FILTERS;
+    
+    return SectionType::UNKNOWN;
+}
+
+ConfigParameter* ConfigSectionData::getParameter(const std::string& key) {
+    auto it = parameters.find(key);
+    return it != parameters.end() ? &it->second : nullptr;
+}
+
+const ConfigParameter* ConfigSectionData::getParameter(const std::string& key) const {
+    auto it = parameters.find(key);
+    return it != parameters.end() ? &it->second : nullptr;
+}
+
+// ============ OopParser Implementation ============
+
+// Generations are unique across parsers, so a handle never mistakes one parser's layout for another's
+static uint64_t nextGeneration() {
+    static std::atomic<uint64_t> counter{0};
+    return ++counter;
+}
+
+OopParser::OopParser() : lastError_(""), generation_(nextGeneration()) {}
+
+OopParser::OopParser(const std::string& filepath) : lastError_(""), generation_(nextGeneration()) {
+    loadFromOop(filepath);
+}
+
+bool OopParser::loadFromOop(const std::string& filepath) {
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        lastError_ = "Cannot open file: " + filepath;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    
+    clear();
+    std::string line;
+    ConfigSectionData currentSection;
+    currentSection.type = SectionType::UNKNOWN;
+
+    while (std::getline(file, line)) {
+        line = trim(line);
+
+        // Skip empty lines and comments
+        if (line.empty() || isComment(line)) {
+            continue;
+        }
+
+        // Check if this is a new section
+        std::string sectionName = isSection(line);
+        if (!sectionName.empty()) {
+            // Save previous section if it has content
+            if (!currentSection.parameters.empty()) {
+                if (schemaTypedLoadActive()) {
+                    applySchemaTypes(currentSection);
+                }
+                sections_.push_back(std::make_shared<ConfigSectionData>(currentSection));
+                bumpGeneration();
+            }
+            // Start new section
+            currentSection.name = sectionName;
+            currentSection.type = ConfigSectionData::stringToSectionType(sectionName);
+            currentSection.parameters.clear();
+        } else {
+            // Parse parameter
+            if (!parseLine(line, currentSection)) {
+                lastError_ = "Error parsing line: " + line;
+                return false;
+            }
+        }
+    }
+
+    // Save last section
+    if (!currentSection.parameters.empty()) {
+        if (schemaTypedLoadActive()) {
+            applySchemaTypes(currentSection);
+        }
+        sections_.push_back(std::make_shared<ConfigSectionData>(currentSection));
+        bumpGeneration();
+    }
+    if (schemaTypedLoadActive()) {
+        addDefaultSections();
+    }
+
+    file.close();
+    return true;
+}
+
+bool OopParser::saveToOop(const std::string& filepath) const {
+    std::ofstream file(filepath);
+    if (!file.is_open()) {
+        lastError_ = "Cannot open file for writing: " + filepath;
+        return false;
+    }
+
+    for (const auto& section : sections_) {
+        // Write section header
+        file << section->name << ".\n";
+
+        // Write parameters
+        for (const auto& [key, param] : section->parameters) {
+            file << "\t" << key << " = " << param.value << "\n";
+        }
+
+        file << "\n";
+    }
+
+    file.close();
+    return true;
+}
+
+bool OopParser::loadFromJson(const std::string& filepath) {
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        lastError_ = "Cannot open JSON file: " + filepath;
+        return false;
+    }
+
+    try {
+        json j;
+        file >> j;
+        file.close();
 
         clear();
 
@@ -400,12 +1190,21 @@ bool OopParser::loadFromJson(const std::string& filepath) {
                     ConfigParameter param;
                     param.key = key;
                     param.value = value.dump();
-                    param.type = detectType(value.dump());
+                    if (!schemaTypedLoadActive()) {
+                        param.type = detectType(param.value);  // Otherwise typed below
+                    }
                     section.parameters[key] = param;
                 }
             }
 
-            sections_.push_back(section);
+            if (schemaTypedLoadActive()) {
+                applySchemaTypes(section);
+            }
+            sections_.push_back(std::make_shared<ConfigSectionData>(std::move(section)));
+            bumpGeneration();
+        }
+        if (schemaTypedLoadActive()) {
+            addDefaultSections();
         }
 
         return true;
@@ -421,7 +1220,7 @@ bool OopParser::saveToJson(const std::string& filepath) const {
 
         for (const auto& section : sections_) {
             json section_obj;
-            for (const auto& [key, param] : section.parameters) {
+            for (const auto& [key, param] : section->parameters) {
                 // Try to parse as JSON, fallback to string if it fails
                 try {
                     section_obj[key] = json::parse(param.value);
@@ -430,7 +1229,7 @@ bool OopParser::saveToJson(const std::string& filepath) const {
                     section_obj[key] = param.value;
                 }
             }
-            j[section.name] = section_obj;
+            j[section->name] = section_obj;
         }
 
         std::ofstream file(filepath);
@@ -449,13 +1248,54 @@ bool OopParser::saveToJson(const std::string& filepath) const {
 }
 
 std::vector<ConfigSectionData> OopParser::getAllSections() const {
-    return sections_;
+    std::vector<ConfigSectionData> result;
+    result.reserve(sections_.size());
+    for (const auto& section : sections_) {
+        result.push_back(*section);
+    }
+    return result;
+}
+
+void OopParser::forEachSection(const std::function<void(const ConfigSectionData&)>& visitor) const {
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    for (const auto& section : sections_) {
+        visitor(*section);
+    }
+}
+
+SectionsView OopParser::viewSections() const {
+    return SectionsView(std::unique_lock<std::mutex>(sectionsMutex_), sections_);
+}
+
+SectionsView::SectionsView(std::unique_lock<std::mutex> lock, const SectionList& sections)
+    : lock_(std::move(lock)), sections_(&sections) {}
+
+SectionsView::const_iterator SectionsView::begin() const {
+    return const_iterator(sections_->begin());
+}
+
+SectionsView::const_iterator SectionsView::end() const {
+    return const_iterator(sections_->end());
+}
+
+size_t SectionsView::size() const {
+    return sections_->size();
+}
+
+bool SectionsView::empty() const {
+    return sections_->empty();
+}
+
+const ConfigSectionData& SectionsView::operator[](size_t index) const {
+    return *(*sections_)[index];
 }
 
 ConfigSectionData* OopParser::getSection(SectionType type) {
     for (auto& section : sections_) {
-        if (section.type == type) {
-            return &section;
+        if (section->type == type) {
+            // Callers may add or remove parameters through the pointer
+            bumpGeneration();
+            return &lendSection(section);
         }
     }
     return nullptr;
@@ -463,8 +1303,8 @@ ConfigSectionData* OopParser::getSection(SectionType type) {
 
 const ConfigSectionData* OopParser::getSection(SectionType type) const {
     for (const auto& section : sections_) {
-        if (section.type == type) {
-            return &section;
+        if (section->type == type) {
+            return section.get();
         }
     }
     return nullptr;
@@ -472,8 +1312,10 @@ const ConfigSectionData* OopParser::getSection(SectionType type) const {
 
 ConfigSectionData* OopParser::getSection(const std::string& name) {
     for (auto& section : sections_) {
-        if (section.name == name) {
-            return &section;
+        if (section->name == name) {
+            // Callers may add or remove parameters through the pointer
+            bumpGeneration();
+            return &lendSection(section);
         }
     }
     return nullptr;
@@ -481,8 +1323,8 @@ ConfigSectionData* OopParser::getSection(const std::string& name) {
 
 const ConfigSectionData* OopParser::getSection(const std::string& name) const {
     for (const auto& section : sections_) {
-        if (section.name == name) {
-            return &section;
+        if (section->name == name) {
+            return section.get();
         }
     }
     return nullptr;
@@ -493,30 +1335,35 @@ bool OopParser::setParameter(const std::string& sectionName,
                              const std::string& value) {
     std::lock_guard<std::mutex> lock(sectionsMutex_);
     
-    ConfigSectionData* section = getSection(sectionName);
-    if (!section) {
+    auto section_it = std::find_if(sections_.begin(), sections_.end(),
+        [&](const auto& s) { return s->name == sectionName; });
+    if (section_it == sections_.end()) {
         // Create new section if it doesn't exist
         ConfigSectionData newSection;
         newSection.name = sectionName;
         newSection.type = ConfigSectionData::stringToSectionType(sectionName);
-        sections_.push_back(newSection);
-        section = &sections_.back();
+        sections_.push_back(std::make_shared<ConfigSectionData>(newSection));
+        bumpGeneration();
+        section_it = sections_.end() - 1;
     }
+    ConfigSectionData* section = &detachSection(*section_it);
 
     ConfigParameter param;
     param.key = paramKey;
     param.value = value;
     param.type = detectType(value);
     
+    if (section->parameters.count(paramKey) == 0) {
+        bumpGeneration();
+    }
     section->parameters[paramKey] = param;
     return true;
 }
 
 ConfigParameter* OopParser::findParameter(const std::string& paramKey) {
     for (auto& section : sections_) {
-        ConfigParameter* param = section.getParameter(paramKey);
-        if (param) {
-            return param;
+        if (section->getParameter(paramKey)) {
+            return lendSection(section).getParameter(paramKey);
         }
     }
     return nullptr;
@@ -524,7 +1371,7 @@ ConfigParameter* OopParser::findParameter(const std::string& paramKey) {
 
 const ConfigParameter* OopParser::findParameter(const std::string& paramKey) const {
     for (const auto& section : sections_) {
-        const ConfigParameter* param = section.getParameter(paramKey);
+        const ConfigParameter* param = section->getParameter(paramKey);
         if (param) {
             return param;
         }
@@ -541,7 +1388,7 @@ bool OopParser::validate(std::vector<std::string>& errors) const {
     for (const auto& req_section : required_sections) {
         bool found = false;
         for (const auto& section : sections_) {
-            if (section.name == req_section) {
+            if (section->name == req_section) {
                 found = true;
                 break;
             }
@@ -556,6 +1403,7 @@ bool OopParser::validate(std::vector<std::string>& errors) const {
 
 void OopParser::clear() {
     sections_.clear();
+    bumpGeneration();
     lastError_ = "";
 }
 
@@ -564,6 +1412,15 @@ size_t OopParser::getSectionCount() const {
     return sections_.size();
 }
 
+size_t OopParser::getParameterCount() const {
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    size_t count = 0;
+    for (const auto& section : sections_) {
+        count += section->parameters.size();
+    }
+    return count;
+}
+
 std::string OopParser::getLastError() const {
     return lastError_;
 }
@@ -596,7 +1453,9 @@ bool OopParser::parseLine(const std::string& line, ConfigSectionData& section) {
     ConfigParameter param;
     param.key = key;
     param.value = value;
-    param.type = detectType(value);
+    if (!schemaTypedLoadActive()) {
+        param.type = detectType(value);     // Otherwise typed when the section is complete
+    }
 
     section.parameters[key] = param;
     return true;
@@ -621,6 +1480,61 @@ std::vector<std::string> OopParser::split(const std::string& str, char delimiter
     return tokens;
 }
 
+bool OopParser::parseNumericArray(const std::string& value, std::vector<double>& out) {
+    out.clear();
+    const char* cursor = value.c_str();
+    const char* end = cursor + value.size();
+    
+    // Strip blanks and optional enclosing brackets
+    while (cursor < end && std::isspace(static_cast<unsigned char>(*cursor))) ++cursor;
+    while (end > cursor && std::isspace(static_cast<unsigned char>(end[-1]))) --end;
+    if (end - cursor >= 2 && *cursor == '[' && end[-1] == ']') {
+        ++cursor;
+        --end;
+    }
+    if (cursor == end) {
+        return true;
+    }
+    
+    bool all_numeric = true;
+    while (true) {
+        const char* delimiter = static_cast<const char*>(std::memchr(cursor, ',', end - cursor));
+        if (!delimiter) {
+            delimiter = end;
+        }
+        
+        char* parsed_end = nullptr;
+        double number = std::strtod(cursor, &parsed_end);
+        if (parsed_end != cursor && parsed_end < delimiter && (*parsed_end == 'd' || *parsed_end == 'D')) {
+            // Rewrite "1.0D-10" as "1.0E-10" in a stack buffer
+            char buffer[64];
+            size_t length = delimiter - cursor;
+            if (length < sizeof(buffer)) {
+                std::memcpy(buffer, cursor, length);
+                buffer[length] = '\0';
+                buffer[parsed_end - cursor] = 'E';
+                char* buffer_end = nullptr;
+                number = std::strtod(buffer, &buffer_end);
+                parsed_end = const_cast<char*>(cursor) + (buffer_end - buffer);
+            }
+        }
+        
+        const char* tail = parsed_end;
+        while (tail < delimiter && std::isspace(static_cast<unsigned char>(*tail))) ++tail;
+        if (parsed_end == cursor || tail != delimiter) {
+            number = std::numeric_limits<double>::quiet_NaN();
+            all_numeric = false;
+        }
+        out.push_back(number);
+        
+        if (delimiter == end) {
+            break;
+        }
+        cursor = delimiter + 1;
+    }
+    return all_numeric;
+}
+
 bool OopParser::isComment(const std::string& line) {
     return !line.empty() && line[0] == '!';
 }
@@ -650,6 +1564,9 @@ std::vector<std::string> OopParser::parseArrayValue(const std::string& value) {
 
 std::string OopParser::detectType(const std::string& value) {
     std::string trimmed = trim(value);
+    if (trimmed.empty()) {
+        return "string";
+    }
 
     // Check for array
     if (trimmed.front() == '[' && trimmed.back() == ']') {
@@ -738,7 +1655,14 @@ bool OopParser::loadFromJsonObject(const nlohmann::json& jsonObj) {
                 }
             }
 
-            sections_.push_back(section);
+            if (schemaTypedLoadActive()) {
+                applySchemaTypes(section);
+            }
+            sections_.push_back(std::make_shared<ConfigSectionData>(std::move(section)));
+            bumpGeneration();
+        }
+        if (schemaTypedLoadActive()) {
+            addDefaultSections();
         }
 
         return true;
@@ -754,7 +1678,7 @@ nlohmann::json OopParser::saveToJsonObject() const {
     for (const auto& section : sections_) {
         json section_obj;
         
-        for (const auto& [key, param] : section.parameters) {
+        for (const auto& [key, param] : section->parameters) {
             // Parse value back to appropriate JSON type
             if (param.type == "string") {
                 // Remove quotes
@@ -790,7 +1714,7 @@ nlohmann::json OopParser::saveToJsonObject() const {
             }
         }
         
-        result[section.name] = section_obj;
+        result[section->name] = section_obj;
     }
 
     return result;
@@ -806,34 +1730,99 @@ bool OopParser::fromJson(const nlohmann::json& jsonObj) {
 
 bool OopParser::validateAgainstSchema(const nlohmann::json& schemaJson, 
                                       std::vector<std::string>& errors) const {
-    errors.clear();
+    return validateAgainstSchema(CompiledJsonSchema(schemaJson), errors);
+}
 
-    // Simple schema validation
-    if (!schemaJson.contains("required")) {
+bool OopParser::validateAgainstSchema(const CompiledJsonSchema& schema,
+                                      std::vector<std::string>& errors) const {
+    using Node = CompiledJsonSchema::Node;
+    errors.clear();
+    if (!schema.isValid()) {
+        errors.push_back("Invalid schema: " + schema.getError());
+        return false;
+    }
+    
+    // The configuration and each section are objects
+    auto checkObject = [&errors](const Node& node, const std::string& name) {
+        if (node.rejectAll) {
+            errors.push_back("/" + name + ": no value is allowed");
+            return false;
+        }
+        if (node.types != 0 && (node.types & CompiledJsonSchema::TYPE_OBJECT) == 0) {
+            errors.push_back("/" + name + ": expected " + jsonTypeNames(node.types) + ", got object");
+            return false;
+        }
+        return true;
+    };
+    // Schema for a member (nullptr when unconstrained); false when the member is not allowed
+    auto memberNode = [&schema](const Node& node, const std::string& name, const Node*& member) {
+        auto it = node.properties.find(name);
+        if (it != node.properties.end()) {
+            member = &schema.nodes_[it->second];
+        } else if (node.additionalSchema != std::string::npos) {
+            member = &schema.nodes_[node.additionalSchema];
+        } else {
+            member = nullptr;
+            return node.additionalAllowed;
+        }
         return true;
+    };
+    auto markRequired = [](const Node& node, const std::string& name, std::vector<bool>& seen) {
+        for (size_t i = 0; i < node.required.size(); ++i) {
+            if (node.required[i] == name) {
+                seen[i] = true;
+            }
+        }
+    };
+    
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    const Node& root = schema.nodes_.front();
+    if (!checkObject(root, "")) {
+        return false;
     }
-
-    auto required = schemaJson["required"];
-    if (required.is_array()) {
-        for (const auto& req_field : required) {
-            if (req_field.is_string()) {
-                const std::string field = req_field.get<std::string>();
-                bool found = false;
-                
-                for (const auto& section : sections_) {
-                    if (section.getParameter(field) != nullptr) {
-                        found = true;
-                        break;
-                    }
-                }
-                
-                if (!found) {
-                    errors.push_back("Missing required field: " + field);
-                }
+    
+    std::vector<bool> sections_seen(root.required.size(), false);
+    std::vector<bool> params_seen;
+    for (const auto& section : sections_) {
+        markRequired(root, section->name, sections_seen);
+        const Node* section_node;
+        if (!memberNode(root, section->name, section_node)) {
+            errors.push_back("/" + section->name + ": additional property not allowed");
+            continue;
+        }
+        if (!section_node || !checkObject(*section_node, section->name)) {
+            continue;
+        }
+        
+        params_seen.assign(section_node->required.size(), false);
+        for (const auto& [key, param] : section->parameters) {
+            markRequired(*section_node, key, params_seen);
+            const Node* param_node;
+            if (!memberNode(*section_node, key, param_node)) {
+                errors.push_back("/" + section->name + "/" + key + ": additional property not allowed");
+            } else if (param_node) {
+                CompiledJsonSchema::checkValue(*param_node, section->name, param, errors);
+            }
+        }
+        for (size_t i = 0; i < params_seen.size(); ++i) {
+            if (!params_seen[i]) {
+                errors.push_back("/" + section->name + ": missing required property '" +
+                                 section_node->required[i] + "'");
             }
         }
     }
-
+    for (size_t i = 0; i < sections_seen.size(); ++i) {
+        if (!sections_seen[i]) {
+            errors.push_back("/: missing required property '" + root.required[i] + "'");
+        }
+    }
+    
+    for (const auto& constraint : schema.constraints_) {
+        if (!checkCrossConstraint_unlocked(constraint)) {
+            errors.push_back("/: constraint violated: " + constraint.getExpression());
+        }
+    }
+    
     return errors.empty();
 }
 
@@ -874,14 +1863,418 @@ bool OopParser::validateWithSchema(const ConfigSchema& schema,
         }
     }
 
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    for (const auto& constraint : schema.constraints) {
+        if (!checkCrossConstraint_unlocked(constraint)) {
+            errors.push_back("Constraint violated: " + constraint.getExpression());
+        }
+    }
+
+    return errors.empty();
+}
+
+bool OopParser::validateWithSchema(const CompiledSchema& schema,
+                                   std::vector<std::string>& errors) const {
+    errors.clear();
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    
+    // One pass over sections_: first section carrying each rule's name
+    std::vector<const ConfigSectionData*> found(schema.sections_.size(), nullptr);
+    for (const auto& section : sections_) {
+        auto rule_it = schema.sectionIndex_.find(section->name);
+        if (rule_it != schema.sectionIndex_.end() && !found[rule_it->second]) {
+            found[rule_it->second] = section.get();
+        }
+    }
+    
+    for (size_t i = 0; i < schema.sections_.size(); ++i) {
+        const auto& section_rule = schema.sections_[i];
+        if (!section_rule.required) {
+            continue;
+        }
+        
+        const ConfigSectionData* section = found[i];
+        if (!section) {
+            errors.push_back("Missing required section: " + section_rule.name);
+            continue;
+        }
+        
+        for (const auto& rule : section_rule.params) {
+            if (!rule.required) {
+                continue;
+            }
+            auto param_it = section->parameters.find(rule.key);
+            if (param_it == section->parameters.end()) {
+                errors.push_back("Missing required parameter '" + rule.key +
+                                 "' in section '" + section_rule.name + "'");
+            } else if (!rule.check(param_it->second.value)) {
+                errors.push_back("Parameter '" + rule.key + "' in section '" + section_rule.name +
+                                 "' failed validation: " + rule.constraintText);
+            }
+        }
+    }
+    
+    for (const auto& constraint : schema.constraints_) {
+        if (!checkCrossConstraint_unlocked(constraint)) {
+            errors.push_back("Constraint violated: " + constraint.getExpression());
+        }
+    }
+    
     return errors.empty();
 }
 
+// Parse a whole value as double (defined with the typed path getters)
+static bool parseDoubleValue(const std::string& text, double& value);
+
+// Parse an ISO 8601 date ("2025-12-01", "2025-12-01T06:30[:15]", quotes allowed) as MJD
+static bool parseIsoDateMjd(const std::string& text, double& mjd) {
+    std::string_view view(text);
+    while (!view.empty() && std::isspace(static_cast<unsigned char>(view.front()))) {
+        view.remove_prefix(1);
+    }
+    while (!view.empty() && std::isspace(static_cast<unsigned char>(view.back()))) {
+        view.remove_suffix(1);
+    }
+    if (view.size() >= 2 && (view.front() == '\'' || view.front() == '"') && view.back() == view.front()) {
+        view = view.substr(1, view.size() - 2);
+    }
+    if (!view.empty() && view.back() == 'Z') {
+        view.remove_suffix(1);
+    }
+    
+    // Fixed-width digit fields at the given offsets
+    auto field = [&view](size_t pos, size_t width, int& out) {
+        if (pos + width > view.size()) {
+            return false;
+        }
+        out = 0;
+        for (size_t i = pos; i < pos + width; ++i) {
+            if (!std::isdigit(static_cast<unsigned char>(view[i]))) {
+                return false;
+            }
+            out = out * 10 + (view[i] - '0');
+        }
+        return true;
+    };
+    int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+    if (!field(0, 4, year) || view.size() < 10 || view[4] != '-' || view[7] != '-' ||
+        !field(5, 2, month) || !field(8, 2, day) || month < 1 || month > 12 || day < 1 || day > 31) {
+        return false;
+    }
+    if (view.size() > 10) {
+        if ((view[10] != 'T' && view[10] != ' ') || !field(11, 2, hour) || view.size() < 16 ||
+            view[13] != ':' || !field(14, 2, minute) || hour > 23 || minute > 59) {
+            return false;
+        }
+        if (view.size() > 16 && (view.size() != 19 || view[16] != ':' || !field(17, 2, second) || second > 60)) {
+            return false;
+        }
+    }
+    
+    // Days since 1970-01-01 (proleptic Gregorian), then shift to MJD
+    int y = year - (month <= 2);
+    int era = (y >= 0 ? y : y - 399) / 400;
+    int yoe = y - era * 400;
+    int doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    long days = static_cast<long>(era) * 146097 + doe - 719468;
+    mjd = static_cast<double>(days + 40587) + (hour * 3600 + minute * 60 + second) / 86400.0;
+    return true;
+}
+
+// Internal helper - assumes lock is already held
+bool OopParser::checkCrossConstraint_unlocked(const CrossConstraint& constraint) const {
+    const auto& refs = constraint.getReferences();
+    double inline_values[8];
+    std::vector<double> heap_values;
+    double* values = inline_values;
+    if (refs.size() > 8) {
+        heap_values.resize(refs.size());
+        values = heap_values.data();
+    }
+    
+    for (size_t i = 0; i < refs.size(); ++i) {
+        const ConfigParameter* param = findPathParameter_unlocked(refs[i].first, refs[i].second);
+        if (!param) {
+            return true;  // Presence is the job of required parameters
+        }
+        if (!parseDoubleValue(param->value, values[i]) && !parseIsoDateMjd(param->value, values[i])) {
+            return false;
+        }
+    }
+    return constraint.evaluate(values);
+}
+
+size_t OopParser::validateSection(const CompiledSchema& schema, const ConfigSectionData& section,
+                                  std::vector<ValidationIssue>& issues) {
+    using Kind = ValidationIssue::Kind;
+    auto rule_it = schema.sectionIndex_.find(section.name);
+    if (rule_it == schema.sectionIndex_.end()) {
+        issues.push_back({Kind::UNKNOWN_SECTION, section.name, "", "", {}});
+        return std::string::npos;
+    }
+    const auto& rules = schema.sections_[rule_it->second].params;
+    
+    // Merge-walk parameters and rules, both sorted by key
+    auto param_it = section.parameters.begin();
+    auto rule = rules.begin();
+    while (param_it != section.parameters.end() || rule != rules.end()) {
+        int order = param_it == section.parameters.end() ? 1
+                  : rule == rules.end() ? -1
+                  : param_it->first.compare(rule->key);
+        if (order < 0) {
+            issues.push_back({Kind::UNKNOWN_PARAMETER, section.name, param_it->first, "", {}});
+            ++param_it;
+        } else if (order > 0) {
+            if (rule->required) {
+                issues.push_back({Kind::MISSING_PARAMETER, section.name, rule->key, "", {}});
+            }
+            ++rule;
+        } else {
+            if (!rule->check(param_it->second.value)) {
+                issues.push_back({Kind::INVALID_VALUE, section.name, rule->key,
+                                  param_it->second.value, rule->constraintText});
+            }
+            ++param_it;
+            ++rule;
+        }
+    }
+    return rule_it->second;
+}
+
+bool OopParser::validateFull(const CompiledSchema& schema, std::vector<ValidationIssue>& issues) const {
+    using Kind = ValidationIssue::Kind;
+    issues.clear();
+    std::vector<bool> seen(schema.sections_.size(), false);
+    
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    for (const auto& section : sections_) {
+        size_t rule = validateSection(schema, *section, issues);
+        if (rule != std::string::npos) {
+            seen[rule] = true;
+        }
+    }
+    
+    for (size_t i = 0; i < schema.sections_.size(); ++i) {
+        if (!seen[i] && schema.sections_[i].required) {
+            issues.push_back({Kind::MISSING_SECTION, schema.sections_[i].name, "", "", {}});
+        }
+    }
+    
+    for (const auto& constraint : schema.constraints_) {
+        if (!checkCrossConstraint_unlocked(constraint)) {
+            issues.push_back({Kind::CONSTRAINT_VIOLATED, "", "", "", constraint.getExpression()});
+        }
+    }
+    
+    return issues.empty();
+}
+
+bool OopParser::revalidate() const {
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    return revalidate_unlocked();
+}
+
+bool OopParser::revalidate(std::vector<ValidationIssue>& issues) const {
+    issues.clear();
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    bool valid = revalidate_unlocked();
+    if (!compiledSchema_) {
+        return valid;
+    }
+    
+    issues.reserve(validationIssueCount_ + validationMissing_.size());
+    for (const auto& section : sections_) {
+        const auto& cached = validationCache_.at(section.get()).issues;
+        issues.insert(issues.end(), cached.begin(), cached.end());
+    }
+    issues.insert(issues.end(), validationMissing_.begin(), validationMissing_.end());
+    issues.insert(issues.end(), validationCross_.begin(), validationCross_.end());
+    return valid;
+}
+
+// Internal helper - assumes lock is already held
+bool OopParser::revalidate_unlocked() const {
+    if (!compiledSchema_) {
+        return true;
+    }
+    const CompiledSchema& schema = *compiledSchema_;
+    
+    // Sections were added, removed or replaced: resync the cache with sections_
+    bool sections_changed = validatedGeneration_ != generation_;
+    const bool anything_changed = sections_changed || !validationDirty_.empty();
+    if (sections_changed) {
+        std::unordered_set<const ConfigSectionData*> live;
+        live.reserve(sections_.size());
+        for (const auto& section : sections_) {
+            live.insert(section.get());
+        }
+        for (auto it = validationCache_.begin(); it != validationCache_.end();) {
+            if (live.count(it->first) && !it->second.section.expired()) {
+                ++it;
+                continue;
+            }
+            validationIssueCount_ -= it->second.issues.size();
+            it = validationCache_.erase(it);
+        }
+        for (const auto& section : sections_) {
+            auto [it, inserted] = validationCache_.try_emplace(section.get());
+            if (inserted) {
+                it->second.section = section;
+                validationDirty_.insert(section.get());
+            }
+        }
+        validatedGeneration_ = generation_;
+    }
+    
+    for (const ConfigSectionData* dirty : validationDirty_) {
+        auto it = validationCache_.find(dirty);
+        if (it == validationCache_.end()) {
+            continue;  // Removed since it was changed
+        }
+        auto section = it->second.section.lock();
+        validationIssueCount_ -= it->second.issues.size();
+        it->second.issues.clear();
+        size_t rule = validateSection(schema, *section, it->second.issues);
+        sections_changed = sections_changed || rule != it->second.ruleIndex;
+        it->second.ruleIndex = rule;
+        validationIssueCount_ += it->second.issues.size();
+    }
+    validationDirty_.clear();
+    
+    // Missing sections only change with the set of section names
+    if (sections_changed) {
+        std::vector<bool> seen(schema.sections_.size(), false);
+        for (const auto& [ptr, entry] : validationCache_) {
+            if (entry.ruleIndex != std::string::npos) {
+                seen[entry.ruleIndex] = true;
+            }
+        }
+        validationMissing_.clear();
+        for (size_t i = 0; i < schema.sections_.size(); ++i) {
+            if (!seen[i] && schema.sections_[i].required) {
+                validationMissing_.push_back({ValidationIssue::Kind::MISSING_SECTION,
+                                              schema.sections_[i].name, "", "", {}});
+            }
+        }
+    }
+    
+    // Cross-parameter rules are few and may span sections: re-run them on any change
+    if (anything_changed) {
+        validationCross_.clear();
+        for (const auto& constraint : schema.constraints_) {
+            if (!checkCrossConstraint_unlocked(constraint)) {
+                validationCross_.push_back({ValidationIssue::Kind::CONSTRAINT_VIOLATED, "", "", "",
+                                            constraint.getExpression()});
+            }
+        }
+    }
+    
+    return validationIssueCount_ == 0 && validationMissing_.empty() && validationCross_.empty();
+}
+
 void OopParser::setSchema(const ConfigSchema& schema) {
-    schema_ = std::make_unique<ConfigSchema>(schema);
+    // Build both outside the lock, publish them together
+    auto copy = std::make_shared<const ConfigSchema>(schema);
+    auto compiled = std::make_shared<const CompiledSchema>(schema);
+    
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    schema_ = std::move(copy);
+    compiledSchema_ = std::move(compiled);
+    validationCache_.clear();
+    validationDirty_.clear();
+    validationMissing_.clear();
+    validationCross_.clear();
+    validationIssueCount_ = 0;
+    validatedGeneration_ = 0;
+}
+
+void OopParser::setSchemaTypedLoading(bool enabled) {
+    schemaTypedLoading_ = enabled;
+}
+
+bool OopParser::isSchemaTypedLoading() const {
+    return schemaTypedLoading_;
+}
+
+bool OopParser::schemaTypedLoadActive() const {
+    return schemaTypedLoading_ && compiledSchema_ != nullptr;
+}
+
+// Give a parameter its declared type if the value parses as that type
+static bool applyDeclaredType(const std::string& type, ConfigParameter& param);
+
+// Internal helper - assumes lock is already held
+void OopParser::applySchemaTypes(ConfigSectionData& section) const {
+    auto rule_it = compiledSchema_->sectionIndex_.find(section.name);
+    if (rule_it == compiledSchema_->sectionIndex_.end()) {
+        for (auto& [key, param] : section.parameters) {
+            if (param.type.empty()) {
+                param.type = detectType(param.value);
+            }
+        }
+        return;
+    }
+    const auto& rules = compiledSchema_->sections_[rule_it->second].params;
+    
+    // Merge-walk parameters and rules, both sorted by key
+    auto param_it = section.parameters.begin();
+    auto rule = rules.begin();
+    while (param_it != section.parameters.end() || rule != rules.end()) {
+        int order = param_it == section.parameters.end() ? 1
+                  : rule == rules.end() ? -1
+                  : param_it->first.compare(rule->key);
+        if (order > 0) {
+            // Missing: fill in the default of an optional parameter
+            if (!rule->required && !rule->defaultValue.empty()) {
+                ConfigParameter param;
+                param.key = rule->key;
+                param.value = rule->defaultValue;
+                if (rule->type.empty() || !applyDeclaredType(rule->type, param)) {
+                    param.type = detectType(param.value);
+                }
+                section.parameters.emplace_hint(param_it, rule->key, std::move(param));
+            }
+            ++rule;
+            continue;
+        }
+        
+        ConfigParameter& param = param_it->second;
+        bool typed = order == 0 && !rule->type.empty() && applyDeclaredType(rule->type, param);
+        if (!typed && param.type.empty()) {
+            param.type = detectType(param.value);
+        }
+        if (order == 0) {
+            ++rule;
+        }
+        ++param_it;
+    }
+}
+
+// Internal helper - assumes lock is already held
+void OopParser::addDefaultSections() {
+    std::unordered_set<std::string> loaded;
+    for (const auto& section : sections_) {
+        loaded.insert(section->name);
+    }
+    for (const auto& rule : compiledSchema_->sections_) {
+        // A missing required section stays missing so validation reports it
+        if (rule.required || loaded.count(rule.name)) {
+            continue;
+        }
+        ConfigSectionData section;
+        section.name = rule.name;
+        section.type = ConfigSectionData::stringToSectionType(rule.name);
+        applySchemaTypes(section);
+        if (!section.parameters.empty()) {
+            sections_.push_back(std::make_shared<ConfigSectionData>(std::move(section)));
+            bumpGeneration();
+        }
+    }
 }
 
 const ConfigSchema* OopParser::getSchema() const {
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
     return schema_.get();
 }
 
@@ -972,6 +2365,16 @@ ConfigSchema OopParser::createDefaultSchema() {
 
 // ============ ConfigSchema JSON Export ============
 
+// JSON Schema type of a declared ParameterSpec::type (nullptr if undeclared)
+static const char* jsonSchemaType(const std::string& type) {
+    if (type == "int") return "integer";
+    if (type == "float") return "number";
+    if (type == "bool") return "boolean";
+    if (type == "array") return "array";
+    if (type == "string") return "string";
+    return nullptr;
+}
+
 nlohmann::json ConfigSchema::toJsonSchema() const {
     json schema;
     
@@ -1029,6 +2432,12 @@ nlohmann::json ConfigSchema::toJsonSchema() const {
             } else {
                 param_prop["type"] = "string";
             }
+            if (const char* declared = jsonSchemaType(param_spec.type)) {
+                param_prop["type"] = declared;
+            }
+            if (!param_spec.default_value.empty()) {
+                param_prop["default"] = param_spec.default_value;
+            }
             
             section_properties[param_key] = param_prop;
             
@@ -1049,10 +2458,47 @@ nlohmann::json ConfigSchema::toJsonSchema() const {
         }
     }
     
+    // Single-parameter bounds map onto JSON Schema keywords; every rule is also listed verbatim
+    json constraint_array = json::array();
+    for (const auto& constraint : constraints) {
+        constraint_array.push_back(constraint.getExpression());
+        
+        size_t ref;
+        CrossConstraint::Op op;
+        double bound;
+        if (!constraint.asBound(ref, op, bound)) {
+            continue;
+        }
+        const auto& [section_name, param_key] = constraint.getReferences()[ref];
+        auto section_it = properties.find(section_name);
+        if (section_it == properties.end() || !(*section_it)["properties"].contains(param_key)) {
+            continue;
+        }
+        json& param_prop = (*section_it)["properties"][param_key];
+        if (param_prop.contains("enum")) {
+            continue;
+        }
+        const char* keyword = op == CrossConstraint::Op::GE ? "minimum"
+                            : op == CrossConstraint::Op::GT ? "exclusiveMinimum"
+                            : op == CrossConstraint::Op::LE ? "maximum" : "exclusiveMaximum";
+        // Keep the tighter bound when the spec already has one
+        bool lower = op == CrossConstraint::Op::GE || op == CrossConstraint::Op::GT;
+        if (!param_prop.contains(keyword) ||
+            (lower ? bound > param_prop[keyword].get<double>() : bound < param_prop[keyword].get<double>())) {
+            if (!param_prop.contains("type") || param_prop["type"] == "string") {
+                param_prop["type"] = "number";
+            }
+            param_prop[keyword] = bound;
+        }
+    }
+    
     schema["properties"] = properties;
     if (!required_array.empty()) {
         schema["required"] = required_array;
     }
+    if (!constraint_array.empty()) {
+        schema["constraints"] = constraint_array;
+    }
     
     return schema;
 }
@@ -1078,15 +2524,430 @@ std::string ConfigSchema::toJsonSchemaString(int indent) const {
     return schema.dump(indent);
 }
 
-// ============ ConfigBuilder Implementation ============
+// Scalar JSON value as OOP text (strings unquoted)
+static std::string jsonScalarText(const json& value) {
+    return value.is_string() ? value.get<std::string>() : value.dump();
+}
 
-ConfigBuilder::ConfigBuilder() : currentSectionIndex_(-1) {}
+// Range from minimum/maximum keywords; false if the property has none
+static bool jsonSchemaRange(const json& prop, RangeConstraint& constraint) {
+    std::string lower, upper;
+    for (const char* keyword : {"minimum", "exclusiveMinimum"}) {
+        if (prop.contains(keyword) && prop[keyword].is_number()) {
+            constraint.min_value = prop[keyword].get<double>();
+            constraint.min_inclusive = keyword[0] == 'm';
+            lower = prop[keyword].dump() + (constraint.min_inclusive ? " <= " : " < ");
+        }
+    }
+    for (const char* keyword : {"maximum", "exclusiveMaximum"}) {
+        if (prop.contains(keyword) && prop[keyword].is_number()) {
+            constraint.max_value = prop[keyword].get<double>();
+            constraint.max_inclusive = keyword[0] == 'm';
+            upper = (constraint.max_inclusive ? " <= " : " < ") + prop[keyword].dump();
+        }
+    }
+    if (lower.empty() && upper.empty()) {
+        return false;
+    }
+    constraint.enabled = true;
+    constraint.constraint_expr = lower + "d" + upper;
+    return true;
+}
 
-ConfigBuilder& ConfigBuilder::addSection(const std::string& sectionName) {
-    ConfigSectionData section;
-    section.name = sectionName;
-    section.type = ConfigSectionData::stringToSectionType(sectionName);
-    section.parameters.clear();
+bool ConfigSchema::fromJsonSchema(const nlohmann::json& schema) {
+    if (!schema.is_object() || !schema.contains("properties") || !schema["properties"].is_object()) {
+        return false;
+    }
+    
+    auto requiredNames = [](const json& node) {
+        std::set<std::string> names;
+        if (node.contains("required") && node["required"].is_array()) {
+            for (const auto& entry : node["required"]) {
+                if (entry.is_string()) {
+                    names.insert(entry.get<std::string>());
+                }
+            }
+        }
+        return names;
+    };
+    auto text = [](const json& node, const char* key) {
+        return node.contains(key) && node[key].is_string() ? node[key].get<std::string>() : std::string();
+    };
+    
+    ConfigSchema loaded;
+    loaded.name = text(schema, "title");
+    loaded.version = text(schema, "version");
+    
+    std::set<std::string> required_sections = requiredNames(schema);
+    for (const auto& [section_name, section_prop] : schema["properties"].items()) {
+        if (!section_prop.is_object()) {
+            continue;
+        }
+        SectionSpec section;
+        section.name = section_name;
+        section.required = required_sections.count(section_name) > 0;
+        section.description = text(section_prop, "description");
+        
+        std::set<std::string> required_params = requiredNames(section_prop);
+        if (section_prop.contains("properties") && section_prop["properties"].is_object()) {
+            for (const auto& [param_key, param_prop] : section_prop["properties"].items()) {
+                if (!param_prop.is_object()) {
+                    continue;
+                }
+                ParameterSpec spec;
+                spec.key = param_key;
+                spec.required = required_params.count(param_key) > 0;
+                spec.description = text(param_prop, "description");
+                if (param_prop.contains("default") && !param_prop["default"].is_null()) {
+                    spec.default_value = jsonScalarText(param_prop["default"]);
+                }
+                
+                // "string" is also what toJsonSchema() writes for undeclared types
+                std::string type = text(param_prop, "type");
+                spec.type = type == "integer" ? "int" : type == "number" ? "float"
+                          : type == "boolean" ? "bool" : type == "array" ? "array" : "";
+                
+                if (param_prop.contains("enum") && param_prop["enum"].is_array()) {
+                    for (const auto& value : param_prop["enum"]) {
+                        spec.allowed_values.push_back(jsonScalarText(value));
+                    }
+                }
+                std::string range = text(param_prop, "constraint");
+                if (range.empty() || !spec.constraint.parseExpression(range)) {
+                    spec.constraint = RangeConstraint();
+                    jsonSchemaRange(param_prop, spec.constraint);
+                }
+                section.addParameter(spec);
+            }
+        }
+        loaded.addSection(section);
+    }
+    
+    if (schema.contains("constraints") && schema["constraints"].is_array()) {
+        for (const auto& expression : schema["constraints"]) {
+            if (!expression.is_string() || !loaded.addConstraint(expression.get<std::string>())) {
+                return false;
+            }
+        }
+    }
+    
+    *this = std::move(loaded);
+    return true;
+}
+
+bool ConfigSchema::loadJsonSchema(const std::string& filepath) {
+    try {
+        std::ifstream file(filepath);
+        if (!file.is_open()) {
+            return false;
+        }
+        
+        json schema;
+        file >> schema;
+        return fromJsonSchema(schema);
+    } catch (...) {
+        return false;
+    }
+}
+
+// ============ ConfigSchema C++ Code Generation ============
+
+static bool parseIntValue(const std::string& text, int& value);
+static bool parseBoolValue(const std::string& text, bool& value);
+
+namespace {
+
+// Turn a section or parameter name into a valid C++ identifier
+std::string cppIdentifier(const std::string& name) {
+    static const std::set<std::string> keywords = {
+        "auto", "bool", "break", "case", "char", "class", "const", "continue", "default",
+        "delete", "do", "double", "else", "enum", "explicit", "extern", "false", "float",
+        "for", "friend", "goto", "if", "inline", "int", "long", "namespace", "new",
+        "operator", "private", "protected", "public", "register", "return", "short",
+        "signed", "sizeof", "static", "struct", "switch", "template", "this", "throw",
+        "true", "try", "typedef", "typename", "union", "unsigned", "using", "virtual",
+        "void", "volatile", "while"};
+    
+    std::string id;
+    for (char c : name) {
+        if (std::isalnum(static_cast<unsigned char>(c))) {
+            id += c;
+        } else if (!id.empty() && id.back() != '_') {
+            id += '_';      // Leading separators (".id") are dropped
+        }
+    }
+    while (!id.empty() && id.back() == '_') {
+        id.pop_back();
+    }
+    if (id.empty() || std::isdigit(static_cast<unsigned char>(id.front()))) {
+        id = "p_" + id;
+    }
+    if (keywords.count(id)) {
+        id += '_';
+    }
+    return id;
+}
+
+// Struct name for a section: "propag" -> "PropagSection"
+std::string cppSectionStruct(const std::string& name) {
+    std::string id = cppIdentifier(name);
+    std::string result;
+    bool upper = true;
+    for (char c : id) {
+        if (c == '_') {
+            upper = true;
+        } else {
+            result += upper ? static_cast<char>(std::toupper(static_cast<unsigned char>(c))) : c;
+            upper = false;
+        }
+    }
+    return result + "Section";
+}
+
+// Quote text as a C++ string literal
+std::string cppStringLiteral(const std::string& text) {
+    std::string result = "\"";
+    for (char c : text) {
+        switch (c) {
+            case '"':  result += "\\\""; break;
+            case '\\': result += "\\\\"; break;
+            case '\n': result += "\\n"; break;
+            case '\t': result += "\\t"; break;
+            default:   result += c; break;
+        }
+    }
+    return result + "\"";
+}
+
+// Single-line text for a generated comment
+std::string cppComment(const std::string& text) {
+    std::string result = text;
+    std::replace(result.begin(), result.end(), '\n', ' ');
+    size_t pos;
+    while ((pos = result.find("*/")) != std::string::npos) {
+        result.replace(pos, 2, "* /");
+    }
+    return result;
+}
+
+/// C++ field generated for one parameter
+struct CppField {
+    std::string type;           // C++ type
+    std::string accessor;       // ConfigParameter method decoding the value
+    std::string initializer;    // " = <default>" or "{}"
+};
+
+CppField cppField(const ParameterSpec& spec) {
+    std::string type = spec.type;
+    if (type.empty() && spec.constraint.enabled) {
+        type = "float";
+    }
+    
+    CppField field;
+    if (type == "int") {
+        field = {"int", "asInt()", "{}"};
+        int value = 0;
+        if (!spec.default_value.empty() && parseIntValue(spec.default_value, value)) {
+            field.initializer = " = " + std::to_string(value);
+        }
+    } else if (type == "float") {
+        field = {"double", "asDouble()", "{}"};
+        double value = 0.0;
+        if (!spec.default_value.empty() && parseDoubleValue(spec.default_value, value) && std::isfinite(value)) {
+            std::ostringstream literal;
+            literal.precision(std::numeric_limits<double>::max_digits10);
+            literal << value;
+            std::string text = literal.str();
+            if (text.find_first_of(".e") == std::string::npos) {
+                text += ".0";
+            }
+            field.initializer = " = " + text;
+        }
+    } else if (type == "bool") {
+        field = {"bool", "asBoolean()", "{}"};
+        bool value = false;
+        if (!spec.default_value.empty() && parseBoolValue(spec.default_value, value)) {
+            field.initializer = value ? " = true" : " = false";
+        }
+    } else {
+        field = {"std::string", "asString()", ""};
+        if (!spec.default_value.empty()) {
+            field.initializer = " = " + cppStringLiteral(spec.default_value);
+        }
+    }
+    return field;
+}
+
+} // anonymous namespace
+
+std::string ConfigSchema::toCppHeader(const std::string& namespaceName, const std::string& structName) const {
+    std::ostringstream out;
+    const std::string loader = "load" + structName;
+    
+    out << "/**\n"
+        << " * @brief Generated by ioc-config from schema \"" << cppComment(name) << "\""
+        << (version.empty() ? "" : " " + cppComment(version)) << ". Do not edit.\n"
+        << " */\n\n"
+        << "#pragma once\n\n"
+        << "#include \"ioc_config/oop_parser.h\"\n"
+        << "#include <exception>\n"
+        << "#include <string>\n\n"
+        << "namespace " << namespaceName << " {\n\n";
+    
+    // One struct per section
+    for (const auto& [section_name, section_spec] : sections) {
+        if (!section_spec.description.empty()) {
+            out << "/// " << cppComment(section_spec.description) << "\n";
+        }
+        out << "struct " << cppSectionStruct(section_name) << " {\n";
+        for (const auto& [param_key, param_spec] : section_spec.params) {
+            CppField field = cppField(param_spec);
+            out << "    " << field.type << " " << cppIdentifier(param_key) << field.initializer << ";";
+            if (!param_spec.description.empty()) {
+                out << "  ///< " << cppComment(param_spec.description);
+            }
+            out << "\n";
+        }
+        out << "};\n\n";
+    }
+    
+    out << "/// All sections of schema \"" << cppComment(name) << "\"\n"
+        << "struct " << structName << " {\n";
+    for (const auto& [section_name, section_spec] : sections) {
+        out << "    " << cppSectionStruct(section_name) << " " << cppIdentifier(section_name) << ";\n";
+    }
+    out << "};\n\n";
+    
+    // Loader: one pass over the parser's sections and parameters
+    out << "/**\n"
+        << " * @brief Fill " << structName << " from a parser in one pass\n"
+        << " * @param parser Loaded configuration\n"
+        << " * @param config Receives the values (fields not in the configuration keep their defaults)\n"
+        << " * @param error Optional; receives the reason on failure\n"
+        << " * @return False if a required entry is missing or a value does not convert\n"
+        << " */\n"
+        << "inline bool " << loader << "(const ioc_config::OopParser& parser, " << structName
+        << "& config, std::string* error = nullptr) {\n";
+    
+    // Presence flags, only for what is required
+    auto sectionFlag = [](const std::string& section) { return "seen_" + cppIdentifier(section); };
+    auto paramFlag = [](const std::string& section, const std::string& key) {
+        return "seen_" + cppIdentifier(section) + "_" + cppIdentifier(key);
+    };
+    auto needsSectionFlag = [](const SectionSpec& spec) {
+        return spec.required || std::any_of(spec.params.begin(), spec.params.end(),
+                                            [](const auto& entry) { return entry.second.required; });
+    };
+    for (const auto& [section_name, section_spec] : sections) {
+        if (needsSectionFlag(section_spec)) {
+            out << "    bool " << sectionFlag(section_name) << " = false;\n";
+        }
+        for (const auto& [param_key, param_spec] : section_spec.params) {
+            if (param_spec.required) {
+                out << "    bool " << paramFlag(section_name, param_key) << " = false;\n";
+            }
+        }
+    }
+    out << "    std::string failure;\n\n"
+        << "    parser.forEachSection([&](const ioc_config::ConfigSectionData& section) {\n"
+        << "        if (!failure.empty()) {\n"
+        << "            return;\n"
+        << "        }\n";
+    
+    bool first_section = true;
+    for (const auto& [section_name, section_spec] : sections) {
+        out << "        " << (first_section ? "if" : "} else if") << " (section.name == "
+            << cppStringLiteral(section_name) << ") {\n";
+        first_section = false;
+        if (needsSectionFlag(section_spec)) {
+            out << "            " << sectionFlag(section_name) << " = true;\n";
+        }
+        if (section_spec.params.empty()) {
+            continue;
+        }
+        
+        const std::string target = "config." + cppIdentifier(section_name) + ".";
+        out << "            for (const auto& [key, param] : section.parameters) {\n"
+            << "                try {\n";
+        bool first_param = true;
+        for (const auto& [param_key, param_spec] : section_spec.params) {
+            out << "                    " << (first_param ? "if" : "} else if") << " (key == "
+                << cppStringLiteral(param_key) << ") {\n"
+                << "                        " << target << cppIdentifier(param_key) << " = param."
+                << cppField(param_spec).accessor << ";\n";
+            if (param_spec.required) {
+                out << "                        " << paramFlag(section_name, param_key) << " = true;\n";
+            }
+            first_param = false;
+        }
+        out << "                    }\n"
+            << "                } catch (const std::exception& e) {\n"
+            << "                    failure = \"Invalid value for '\" + section.name + \".\" + key + \"': \" + e.what();\n"
+            << "                    return;\n"
+            << "                }\n"
+            << "            }\n";
+    }
+    if (!first_section) {
+        out << "        }\n";
+    }
+    out << "    });\n\n";
+    
+    // Required entries, reported with the validator's messages
+    std::ostringstream checks;
+    bool first_check = true;
+    for (const auto& [section_name, section_spec] : sections) {
+        if (section_spec.required) {
+            checks << "        " << (first_check ? "if" : "} else if") << " (!" << sectionFlag(section_name) << ") {\n"
+                   << "            failure = " << cppStringLiteral("Missing required section: " + section_name) << ";\n";
+            first_check = false;
+        }
+        for (const auto& [param_key, param_spec] : section_spec.params) {
+            if (!param_spec.required) {
+                continue;
+            }
+            checks << "        " << (first_check ? "if" : "} else if") << " (" << sectionFlag(section_name)
+                   << " && !" << paramFlag(section_name, param_key) << ") {\n"
+                   << "            failure = " << cppStringLiteral("Missing required parameter '" + param_key +
+                                                                   "' in section '" + section_name + "'") << ";\n";
+            first_check = false;
+        }
+    }
+    if (!first_check) {
+        out << "    if (failure.empty()) {\n" << checks.str() << "        }\n    }\n\n";
+    }
+    
+    out << "    if (!failure.empty()) {\n"
+        << "        if (error) {\n"
+        << "            *error = failure;\n"
+        << "        }\n"
+        << "        return false;\n"
+        << "    }\n"
+        << "    return true;\n"
+        << "}\n\n"
+        << "} // namespace " << namespaceName << "\n";
+    
+    return out.str();
+}
+
+bool ConfigSchema::saveCppHeader(const std::string& filepath, const std::string& namespaceName,
+                                 const std::string& structName) const {
+    std::ofstream file(filepath);
+    if (!file.is_open()) {
+        return false;
+    }
+    file << toCppHeader(namespaceName, structName);
+    return static_cast<bool>(file);
+}
+
+// ============ ConfigBuilder Implementation ============
+
+ConfigBuilder::ConfigBuilder() : currentSectionIndex_(-1) {}
+
+ConfigBuilder& ConfigBuilder::addSection(const std::string& sectionName) {
+    ConfigSectionData section;
+    section.name = sectionName;
+    section.type = ConfigSectionData::stringToSectionType(sectionName);
+    section.parameters.clear();
     
     sections_.push_back(section);
     currentSection_ = sectionName;
@@ -1199,11 +3060,11 @@ bool OopParser::saveToYaml(const std::string& filepath) const {
         for (const auto& section : sections_) {
             YAML::Node sectionNode;
             
-            for (const auto& param : section.parameters) {
-                sectionNode[param.key] = param.value;
+            for (const auto& [key, param] : section->parameters) {
+                sectionNode[key] = param.value;
             }
             
-            config[section.name] = sectionNode;
+            config[section->name] = sectionNode;
         }
         
         std::ofstream file(filepath);
@@ -1237,11 +3098,11 @@ std::string OopParser::saveToYamlString() const {
         for (const auto& section : sections_) {
             YAML::Node sectionNode;
             
-            for (const auto& param : section.parameters) {
-                sectionNode[param.key] = param.value;
+            for (const auto& [key, param] : section->parameters) {
+                sectionNode[key] = param.value;
             }
             
-            config[section.name] = sectionNode;
+            config[section->name] = sectionNode;
         }
         
         YAML::Emitter emitter;
@@ -1497,7 +3358,8 @@ bool OopParser::loadFromXmlString(const std::string& xmlString) {
             }
             
             if (!section.parameters.empty()) {
-                sections_.push_back(section);
+                sections_.push_back(std::make_shared<ConfigSectionData>(std::move(section)));
+                bumpGeneration();
             }
         }
         
@@ -1521,10 +3383,10 @@ std::string OopParser::saveToXmlString() const {
         oss << "<config>\n";
         
         for (const auto& section : sections_) {
-            oss << "  <" << section.name;
+            oss << "  <" << section->name;
             
             // Output attributes
-            for (const auto& [key, param] : section.parameters) {
+            for (const auto& [key, param] : section->parameters) {
                 if (key != "._content") {
                     // Remove leading dot
                     std::string attr_name = (key.length() > 0 && key[0] == '.') ? key.substr(1) : key;
@@ -1546,8 +3408,8 @@ std::string OopParser::saveToXmlString() const {
             }
             
             // Check for content
-            auto content_it = section.parameters.find("._content");
-            if (content_it != section.parameters.end()) {
+            auto content_it = section->parameters.find("._content");
+            if (content_it != section->parameters.end()) {
                 oss << ">";
                 // Escape XML special characters in content
                 for (char c : content_it->second.value) {
@@ -1558,7 +3420,7 @@ std::string OopParser::saveToXmlString() const {
                         default: oss << c;
                     }
                 }
-                oss << "</" << section.name << ">\n";
+                oss << "</" << section->name << ">\n";
             } else {
                 oss << " />\n";
             }
@@ -1787,7 +3649,8 @@ bool OopParser::loadFromCsvString(const std::string& csvString, bool hasHeader)
             }
             
             if (!section.parameters.empty()) {
-                sections_.push_back(section);
+                sections_.push_back(std::make_shared<ConfigSectionData>(std::move(section)));
+                bumpGeneration();
             }
         }
         
@@ -1811,7 +3674,7 @@ std::string OopParser::saveToCsvString(bool withHeader) const {
         // Collect all unique parameter keys
         std::set<std::string> all_keys;
         for (const auto& section : sections_) {
-            for (const auto& [key, param] : section.parameters) {
+            for (const auto& [key, param] : section->parameters) {
                 all_keys.insert(key);
             }
         }
@@ -1832,13 +3695,13 @@ std::string OopParser::saveToCsvString(bool withHeader) const {
         
         // Write data rows
         for (const auto& section : sections_) {
-            oss << section.name;
+            oss << section->name;
             
             for (const auto& key : sorted_keys) {
                 oss << ",";
                 
-                auto it = section.parameters.find(key);
-                if (it != section.parameters.end()) {
+                auto it = section->parameters.find(key);
+                if (it != section->parameters.end()) {
                     const auto& value = it->second.value;
                     
                     // Quote if contains comma, quotes, or newlines
@@ -1909,7 +3772,8 @@ bool OopParser::loadFromToml(const std::string& filepath) {
             }
             
             if (!section.parameters.empty()) {
-                sections_.push_back(section);
+                sections_.push_back(std::make_shared<ConfigSectionData>(std::move(section)));
+                bumpGeneration();
             }
         }
         
@@ -1928,7 +3792,7 @@ bool OopParser::saveToToml(const std::string& filepath) const {
         for (const auto& section : sections_) {
             toml::table section_table;
             
-            for (const auto& [key, param] : section.parameters) {
+            for (const auto& [key, param] : section->parameters) {
                 std::string clean_key = key;
                 if (clean_key[0] == '.') {
                     clean_key = clean_key.substr(1);
@@ -1945,7 +3809,7 @@ bool OopParser::saveToToml(const std::string& filepath) const {
                 }
             }
             
-            root.insert(section.name, section_table);
+            root.insert(section->name, section_table);
         }
         
         std::ofstream file(filepath);
@@ -2002,7 +3866,8 @@ bool OopParser::loadFromTomlString(const std::string& tomlString) {
             }
             
             if (!section.parameters.empty()) {
-                sections_.push_back(section);
+                sections_.push_back(std::make_shared<ConfigSectionData>(std::move(section)));
+                bumpGeneration();
             }
         }
         
@@ -2021,7 +3886,7 @@ std::string OopParser::saveToTomlString() const {
         for (const auto& section : sections_) {
             toml::table section_table;
             
-            for (const auto& [key, param] : section.parameters) {
+            for (const auto& [key, param] : section->parameters) {
                 std::string clean_key = key;
                 if (clean_key[0] == '.') {
                     clean_key = clean_key.substr(1);
@@ -2038,7 +3903,7 @@ std::string OopParser::saveToTomlString() const {
                 }
             }
             
-            root.insert(section.name, section_table);
+            root.insert(section->name, section_table);
         }
         
         std::ostringstream oss;
@@ -2090,32 +3955,34 @@ bool OopParser::merge(const OopParser& other, MergeStrategy strategy) {
 
     for (const auto& other_section : other.sections_) {
         auto it = std::find_if(sections_.begin(), sections_.end(),
-            [&](const ConfigSectionData& s) { return s.name == other_section.name; });
+            [&](const auto& s) { return s->name == other_section->name; });
 
         if (it == sections_.end()) {
-            // Section doesn't exist - add it
+            // Section doesn't exist - share it until either side modifies it
             sections_.push_back(other_section);
+            bumpGeneration();
             mergeStats_.sections_added++;
         } else {
             // Section exists - merge parameters based on strategy
+            ConfigSectionData& target = detachSection(*it);
             if (strategy == MergeStrategy::REPLACE || strategy == MergeStrategy::DEEP_MERGE) {
-                for (const auto& [key, param] : other_section.parameters) {
-                    if (it->parameters.find(key) != it->parameters.end()) {
-                        if (it->parameters[key].value != param.value) {
-                            it->parameters[key] = param;
+                for (const auto& [key, param] : other_section->parameters) {
+                    if (target.parameters.find(key) != target.parameters.end()) {
+                        if (target.parameters[key].value != param.value) {
+                            target.parameters[key] = param;
                             mergeStats_.parameters_modified++;
                         }
                     } else {
-                        it->parameters[key] = param;
+                        target.parameters[key] = param;
                         mergeStats_.parameters_added++;
                     }
                 }
                 mergeStats_.sections_updated++;
             } else if (strategy == MergeStrategy::APPEND) {
                 // Only add new parameters, don't replace existing
-                for (const auto& [key, param] : other_section.parameters) {
-                    if (it->parameters.find(key) == it->parameters.end()) {
-                        it->parameters[key] = param;
+                for (const auto& [key, param] : other_section->parameters) {
+                    if (target.parameters.find(key) == target.parameters.end()) {
+                        target.parameters[key] = param;
                         mergeStats_.parameters_added++;
                     }
                 }
@@ -2123,6 +3990,7 @@ bool OopParser::merge(const OopParser& other, MergeStrategy strategy) {
         }
     }
 
+    bumpGeneration();
     return true;
 }
 
@@ -2138,18 +4006,20 @@ bool OopParser::mergeWithResolver(const OopParser& other,
 
     for (const auto& other_section : other.sections_) {
         auto it = std::find_if(sections_.begin(), sections_.end(),
-            [&](const ConfigSectionData& s) { return s.name == other_section.name; });
+            [&](const auto& s) { return s->name == other_section->name; });
 
         if (it == sections_.end()) {
             sections_.push_back(other_section);
+            bumpGeneration();
             mergeStats_.sections_added++;
         } else {
-            for (const auto& [key, param] : other_section.parameters) {
-                auto existing = it->parameters.find(key);
-                if (existing != it->parameters.end() && existing->second.value != param.value) {
+            ConfigSectionData& target = detachSection(*it);
+            for (const auto& [key, param] : other_section->parameters) {
+                auto existing = target.parameters.find(key);
+                if (existing != target.parameters.end() && existing->second.value != param.value) {
                     // Conflict detected - use resolver
                     MergeConflict conflict;
-                    conflict.section = other_section.name;
+                    conflict.section = other_section->name;
                     conflict.key = key;
                     conflict.existingValue = existing->second.value;
                     conflict.incomingValue = param.value;
@@ -2164,8 +4034,8 @@ bool OopParser::mergeWithResolver(const OopParser& other,
                         mergeStats_.conflicts++;
                         mergeStats_.conflict_keys.push_back(key);
                     }
-                } else if (existing == it->parameters.end()) {
-                    it->parameters[key] = param;
+                } else if (existing == target.parameters.end()) {
+                    target.parameters[key] = param;
                     mergeStats_.parameters_added++;
                 }
             }
@@ -2173,6 +4043,7 @@ bool OopParser::mergeWithResolver(const OopParser& other,
         }
     }
 
+    bumpGeneration();
     return mergeStats_.conflicts == 0;
 }
 
@@ -2181,15 +4052,20 @@ const MergeStats& OopParser::getLastMergeStats() const {
 }
 
 std::vector<DiffEntry> OopParser::diff(const OopParser& other) const {
+    return diff_impl(other, true);
+}
+
+std::vector<DiffEntry> OopParser::diff_impl(const OopParser& other, bool includeUnchanged) const {
     std::vector<DiffEntry> diffs;
     std::lock_guard<std::mutex> lock(sectionsMutex_);
 
     // Check for sections in this but not in other (REMOVED)
-    for (const auto& section : sections_) {
-        auto other_section = std::find_if(other.sections_.begin(), other.sections_.end(),
-            [&](const ConfigSectionData& s) { return s.name == section.name; });
+    for (const auto& section_ptr : sections_) {
+        const ConfigSectionData& section = *section_ptr;
+        auto other_it = std::find_if(other.sections_.begin(), other.sections_.end(),
+            [&](const auto& s) { return s->name == section.name; });
 
-        if (other_section == other.sections_.end()) {
+        if (other_it == other.sections_.end()) {
             for (const auto& [key, param] : section.parameters) {
                 DiffEntry entry;
                 entry.type = DiffEntry::REMOVED;
@@ -2199,7 +4075,30 @@ std::vector<DiffEntry> OopParser::diff(const OopParser& other) const {
                 entry.oldType = param.type;
                 diffs.push_back(entry);
             }
+            // The section itself, so removal does not depend on it being emptied
+            DiffEntry entry;
+            entry.type = DiffEntry::REMOVED;
+            entry.section = section.name;
+            diffs.push_back(entry);
         } else {
+            const ConfigSectionData* other_section = other_it->get();
+            if (other_section == section_ptr.get()) {
+                // Shared section: identical by construction
+                if (!includeUnchanged) {
+                    continue;
+                }
+                for (const auto& [key, param] : section.parameters) {
+                    DiffEntry entry;
+                    entry.type = DiffEntry::UNCHANGED;
+                    entry.section = section.name;
+                    entry.key = key;
+                    entry.oldValue = param.value;
+                    entry.oldType = param.type;
+                    diffs.push_back(entry);
+                }
+                continue;
+            }
+
             // Check individual parameters
             for (const auto& [key, param] : section.parameters) {
                 auto other_param = other_section->parameters.find(key);
@@ -2223,7 +4122,7 @@ std::vector<DiffEntry> OopParser::diff(const OopParser& other) const {
                     entry.oldType = param.type;
                     entry.newType = other_param->second.type;
                     diffs.push_back(entry);
-                } else {
+                } else if (includeUnchanged) {
                     // Unchanged
                     DiffEntry entry;
                     entry.type = DiffEntry::UNCHANGED;
@@ -2253,13 +4152,18 @@ std::vector<DiffEntry> OopParser::diff(const OopParser& other) const {
     // Check for sections in other but not in this (ADDED)
     for (const auto& other_section : other.sections_) {
         auto section = std::find_if(sections_.begin(), sections_.end(),
-            [&](const ConfigSectionData& s) { return s.name == other_section.name; });
+            [&](const auto& s) { return s->name == other_section->name; });
 
         if (section == sections_.end()) {
-            for (const auto& [key, param] : other_section.parameters) {
+            // The section itself, so it is added even without parameters
+            DiffEntry added;
+            added.type = DiffEntry::ADDED;
+            added.section = other_section->name;
+            diffs.push_back(added);
+            for (const auto& [key, param] : other_section->parameters) {
                 DiffEntry entry;
                 entry.type = DiffEntry::ADDED;
-                entry.section = other_section.name;
+                entry.section = other_section->name;
                 entry.key = key;
                 entry.newValue = param.value;
                 entry.newType = param.type;
@@ -2330,6 +4234,58 @@ nlohmann::json OopParser::diffAsJson(const OopParser& other) const {
     return result;
 }
 
+bool OopParser::applyDiff(const std::vector<DiffEntry>& changes) {
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+
+    for (const auto& entry : changes) {
+        auto section_it = std::find_if(sections_.begin(), sections_.end(),
+            [&](const auto& s) { return s->name == entry.section; });
+
+        if (entry.key.empty()) {
+            // Whole-section entry
+            if (entry.type == DiffEntry::ADDED && section_it == sections_.end()) {
+                ConfigSectionData new_section;
+                new_section.name = entry.section;
+                new_section.type = ConfigSectionData::stringToSectionType(entry.section);
+                sections_.push_back(std::make_shared<ConfigSectionData>(new_section));
+                bumpGeneration();
+            } else if (entry.type == DiffEntry::REMOVED && section_it != sections_.end()) {
+                sections_.erase(section_it);
+                bumpGeneration();
+            }
+            continue;
+        }
+
+        if (entry.type == DiffEntry::ADDED || entry.type == DiffEntry::MODIFIED) {
+            if (section_it == sections_.end()) {
+                ConfigSectionData new_section;
+                new_section.name = entry.section;
+                new_section.type = ConfigSectionData::stringToSectionType(entry.section);
+                sections_.push_back(std::make_shared<ConfigSectionData>(new_section));
+                bumpGeneration();
+                section_it = sections_.end() - 1;
+            }
+
+            ConfigParameter param;
+            param.key = entry.key;
+            param.value = entry.newValue;
+            param.type = entry.newType;
+            detachSection(*section_it).parameters[entry.key] = param;
+        } else if (entry.type == DiffEntry::REMOVED) {
+            if (section_it == sections_.end()) {
+                continue;
+            }
+            if ((*section_it)->parameters.count(entry.key) == 0) {
+                continue;
+            }
+            detachSection(*section_it).parameters.erase(entry.key);
+        }
+    }
+
+    bumpGeneration();
+    return true;
+}
+
 // ============ Cloning & Copying Implementation ============
 
 std::unique_ptr<OopParser> OopParser::clone() const {
@@ -2339,12 +4295,36 @@ std::unique_ptr<OopParser> OopParser::clone() const {
 }
 
 OopParser& OopParser::copyFrom(const OopParser& other) {
-    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    if (&other == this) {
+        return *this;
+    }
+    std::scoped_lock lock(sectionsMutex_, other.sectionsMutex_);
     
+    // Sections are shared with the source and copied on first write. Sections
+    // the source handed out through mutable pointers are copied now, since
+    // writes through those pointers bypass copy-on-write.
     sections_ = other.sections_;
+    lentSections_.clear();
+    if (!other.lentSections_.empty()) {
+        std::unordered_set<const ConfigSectionData*> stillLent;
+        for (auto& section : sections_) {
+            if (other.lentSections_.count(section.get())) {
+                stillLent.insert(section.get());
+                section = std::make_shared<ConfigSectionData>(*section);
+            }
+        }
+        other.lentSections_ = std::move(stillLent);  // Drop sections removed since
+    }
+    bumpGeneration();
     lastError_ = other.lastError_;
     if (other.schema_) {
-        schema_ = std::make_unique<ConfigSchema>(*other.schema_);
+        // Attached schemas are immutable, so copies and snapshots share them
+        schema_ = other.schema_;
+        compiledSchema_ = other.compiledSchema_;
+        validationCache_.clear();
+        validationDirty_.clear();
+        validationIssueCount_ = 0;
+        validatedGeneration_ = 0;
     }
     mergeStats_ = other.mergeStats_;
 
@@ -2356,6 +4336,69 @@ bool OopParser::isEmpty() const {
     return sections_.empty();
 }
 
+// Heap bytes owned by a string (0 while it fits in the small-string buffer)
+static size_t stringHeapBytes(const std::string& str) {
+    static const size_t sso_capacity = std::string().capacity();
+    return str.capacity() > sso_capacity ? str.capacity() + 1 : 0;
+}
+
+// Approximate size of one std::map node holding a parameter
+static size_t parameterBytes(const std::string& key, const ConfigParameter& param) {
+    return sizeof(std::pair<const std::string, ConfigParameter>) + 4 * sizeof(void*) +
+           stringHeapBytes(key) + stringHeapBytes(param.key) +
+           stringHeapBytes(param.value) + stringHeapBytes(param.type);
+}
+
+// Approximate size of a list of diff entries
+static size_t deltaBytes(const std::vector<DiffEntry>& delta) {
+    size_t bytes = delta.capacity() * sizeof(DiffEntry);
+    for (const auto& change : delta) {
+        bytes += stringHeapBytes(change.section) + stringHeapBytes(change.key) +
+                 stringHeapBytes(change.oldValue) + stringHeapBytes(change.newValue) +
+                 stringHeapBytes(change.oldType) + stringHeapBytes(change.newType);
+    }
+    return bytes;
+}
+
+// Approximate size of a heap-allocated section and its parameters
+static size_t sectionBytes(const ConfigSectionData& section) {
+    size_t bytes = sizeof(ConfigSectionData) + 2 * sizeof(long) + stringHeapBytes(section.name);
+    for (const auto& [key, param] : section.parameters) {
+        bytes += parameterBytes(key, param);
+    }
+    return bytes;
+}
+
+size_t OopParser::getMemoryUsage() const {
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+
+    size_t bytes = sections_.capacity() * sizeof(std::shared_ptr<ConfigSectionData>);
+    for (const auto& section : sections_) {
+        bytes += sectionBytes(*section);
+    }
+    return bytes;
+}
+
+ConfigSectionData& OopParser::detachSection(std::shared_ptr<ConfigSectionData>& section) {
+    if (section.use_count() > 1) {
+        section = std::make_shared<ConfigSectionData>(*section);
+        bumpGeneration();
+    }
+    typeIndexDirty_.insert(section.get());
+    validationDirty_.insert(section.get());
+    return *section;
+}
+
+ConfigSectionData& OopParser::lendSection(std::shared_ptr<ConfigSectionData>& section) {
+    ConfigSectionData& detached = detachSection(section);
+    lentSections_.insert(&detached);
+    return detached;
+}
+
+void OopParser::bumpGeneration() {
+    generation_ = nextGeneration();
+}
+
 // ============ Query & Filter Implementation ============
 
 std::vector<ConfigParameter> OopParser::getParametersWhere(
@@ -2364,7 +4407,7 @@ std::vector<ConfigParameter> OopParser::getParametersWhere(
     std::lock_guard<std::mutex> lock(sectionsMutex_);
 
     for (const auto& section : sections_) {
-        for (const auto& [key, param] : section.parameters) {
+        for (const auto& [key, param] : section->parameters) {
             if (predicate(param)) {
                 results.push_back(param);
             }
@@ -2380,98 +4423,645 @@ std::vector<ConfigSectionData> OopParser::getSectionsWhere(
     std::lock_guard<std::mutex> lock(sectionsMutex_);
 
     for (const auto& section : sections_) {
-        if (predicate(section)) {
-            results.push_back(section);
+        if (predicate(*section)) {
+            results.push_back(*section);
         }
     }
 
     return results;
 }
 
-ConfigParameter* OopParser::findWhere(std::function<bool(const ConfigParameter&)> predicate) {
+size_t OopParser::forEachParameterWhere(
+    const std::function<bool(const ConfigParameter&)>& predicate,
+    const std::function<void(const ConfigSectionData&, const ConfigParameter&)>& visitor) const {
     std::lock_guard<std::mutex> lock(sectionsMutex_);
+    size_t matches = 0;
 
-    for (auto& section : sections_) {
-        for (auto& [key, param] : section.parameters) {
+    for (const auto& section : sections_) {
+        for (const auto& [key, param] : section->parameters) {
             if (predicate(param)) {
-                return &param;
+                visitor(*section, param);
+                ++matches;
             }
         }
     }
 
-    return nullptr;
+    return matches;
 }
 
-const ConfigParameter* OopParser::findWhere(std::function<bool(const ConfigParameter&)> predicate) const {
+size_t OopParser::forEachSectionWhere(
+    const std::function<bool(const ConfigSectionData&)>& predicate,
+    const std::function<void(const ConfigSectionData&)>& visitor) const {
     std::lock_guard<std::mutex> lock(sectionsMutex_);
+    size_t matches = 0;
 
     for (const auto& section : sections_) {
-        for (const auto& [key, param] : section.parameters) {
-            if (predicate(param)) {
-                return &param;
-            }
-        }
-    }
-
-    return nullptr;
-}
-
-std::vector<ConfigParameter> OopParser::getParametersByKeyPattern(const std::string& pattern) const {
-    std::vector<ConfigParameter> results;
-    try {
-        std::regex key_regex(pattern, std::regex::icase);
-        std::lock_guard<std::mutex> lock(sectionsMutex_);
-
-        for (const auto& section : sections_) {
-            for (const auto& [key, param] : section.parameters) {
-                if (std::regex_search(key, key_regex)) {
-                    results.push_back(param);
-                }
-            }
+        if (predicate(*section)) {
+            visitor(*section);
+            ++matches;
         }
-    } catch (const std::regex_error& e) {
-        lastError_ = std::string("Invalid regex pattern: ") + e.what();
     }
 
-    return results;
+    return matches;
 }
 
-std::vector<ConfigParameter> OopParser::getParametersByValuePattern(const std::string& pattern) const {
-    std::vector<ConfigParameter> results;
-    try {
-        std::regex value_regex(pattern, std::regex::icase);
-        std::lock_guard<std::mutex> lock(sectionsMutex_);
+ConfigParameter* OopParser::findWhere(std::function<bool(const ConfigParameter&)> predicate) {
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
 
-        for (const auto& section : sections_) {
-            for (const auto& [key, param] : section.parameters) {
-                if (std::regex_search(param.value, value_regex)) {
-                    results.push_back(param);
-                }
+    for (auto& section : sections_) {
+        for (const auto& [key, param] : section->parameters) {
+            if (predicate(param)) {
+                return lendSection(section).getParameter(key);
             }
         }
-    } catch (const std::regex_error& e) {
-        lastError_ = std::string("Invalid regex pattern: ") + e.what();
     }
 
-    return results;
+    return nullptr;
 }
 
-std::vector<ConfigParameter> OopParser::getParametersByType(const std::string& type) const {
-    std::vector<ConfigParameter> results;
+const ConfigParameter* OopParser::findWhere(std::function<bool(const ConfigParameter&)> predicate) const {
     std::lock_guard<std::mutex> lock(sectionsMutex_);
 
     for (const auto& section : sections_) {
-        for (const auto& [key, param] : section.parameters) {
-            if (param.type == type) {
-                results.push_back(param);
+        for (const auto& [key, param] : section->parameters) {
+            if (predicate(param)) {
+                return &param;
             }
         }
     }
 
-    return results;
+    return nullptr;
 }
 
-// ============ Path-Based Access Implementation (RFC 6901) ============
+// ============ Compiled Patterns ============
+
+CompiledPattern::CompiledPattern(const std::string& pattern)
+    : pattern_(pattern), kind_(Kind::REGEX), anchorStart_(false), anchorEnd_(false) {
+    if (!analyze()) {
+        kind_ = Kind::REGEX;
+        segments_.clear();
+        anchorStart_ = anchorEnd_ = false;
+    } else if (kind_ != Kind::GLOB) {
+        return;
+    }
+    
+    // GLOB keeps the regex for texts with line breaks, which ".*" cannot span
+    try {
+        regex_ = std::regex(pattern, std::regex::icase | std::regex::optimize);
+    } catch (const std::regex_error& e) {
+        kind_ = Kind::REGEX;
+        error_ = std::string("Invalid regex pattern: ") + e.what();
+    }
+}
+
+bool CompiledPattern::analyze() {
+    std::string_view body(pattern_);
+    if (!body.empty() && body.front() == '^') {
+        anchorStart_ = true;
+        body.remove_prefix(1);
+    }
+    if (!body.empty() && body.back() == '$') {
+        // A '$' preceded by an odd number of backslashes is a literal
+        size_t slashes = 0;
+        while (slashes + 1 < body.size() && body[body.size() - 2 - slashes] == '\\') {
+            ++slashes;
+        }
+        if (slashes % 2 == 0) {
+            anchorEnd_ = true;
+            body.remove_suffix(1);
+        }
+    }
+    
+    segments_.assign(1, std::string());
+    for (size_t i = 0; i < body.size(); ++i) {
+        char c = body[i];
+        if (c == '\\') {
+            // Escaped punctuation is literal; class escapes (\d, \w, ...) need the regex
+            if (i + 1 >= body.size() || std::isalnum(static_cast<unsigned char>(body[i + 1]))) {
+                return false;
+            }
+            segments_.back() += static_cast<char>(std::tolower(static_cast<unsigned char>(body[++i])));
+        } else if (c == '.' && i + 1 < body.size() && body[i + 1] == '*') {
+            if (!segments_.back().empty() || segments_.size() == 1) {
+                segments_.emplace_back();
+            }
+            ++i;
+        } else if (std::strchr(".^$|?*+()[]{}", c)) {
+            return false;
+        } else {
+            segments_.back() += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+    }
+    
+    // An unanchored leading or trailing ".*" can match nothing, so drop it
+    if (segments_.size() > 1 && segments_.front().empty() && !anchorStart_) {
+        segments_.erase(segments_.begin());
+    }
+    if (segments_.size() > 1 && segments_.back().empty() && !anchorEnd_) {
+        segments_.pop_back();
+    }
+    
+    if (segments_.size() > 1) {
+        kind_ = Kind::GLOB;
+    } else if (anchorStart_ && anchorEnd_) {
+        kind_ = Kind::EXACT;
+    } else if (anchorStart_) {
+        kind_ = Kind::PREFIX;
+    } else if (anchorEnd_) {
+        kind_ = Kind::SUFFIX;
+    } else {
+        kind_ = Kind::LITERAL;
+    }
+    return true;
+}
+
+// Compare text[pos..] with a lower-case literal, ignoring ASCII case
+static bool equalsLowerAt(std::string_view text, size_t pos, std::string_view lower) {
+    for (size_t i = 0; i < lower.size(); ++i) {
+        if (std::tolower(static_cast<unsigned char>(text[pos + i])) != static_cast<unsigned char>(lower[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Find a lower-case literal in text from a position, ignoring ASCII case
+static size_t findLower(std::string_view text, std::string_view lower, size_t from) {
+    if (lower.empty()) {
+        return from <= text.size() ? from : std::string_view::npos;
+    }
+    if (text.size() < lower.size()) {
+        return std::string_view::npos;
+    }
+    
+    const unsigned char first = static_cast<unsigned char>(lower[0]);
+    const unsigned char first_upper = static_cast<unsigned char>(std::toupper(first));
+    for (size_t pos = from; pos + lower.size() <= text.size(); ++pos) {
+        unsigned char c = static_cast<unsigned char>(text[pos]);
+        if ((c == first || c == first_upper) && equalsLowerAt(text, pos + 1, lower.substr(1))) {
+            return pos;
+        }
+    }
+    return std::string_view::npos;
+}
+
+const std::string& CompiledPattern::getPattern() const {
+    return pattern_;
+}
+
+bool CompiledPattern::isValid() const {
+    return error_.empty();
+}
+
+const std::string& CompiledPattern::getError() const {
+    return error_;
+}
+
+bool CompiledPattern::matches(std::string_view text) const {
+    if (!isValid()) {
+        return false;
+    }
+    
+    const std::string& first = kind_ == Kind::REGEX ? pattern_ : segments_.front();
+    switch (kind_) {
+        case Kind::LITERAL:
+            return findLower(text, first, 0) != std::string_view::npos;
+        case Kind::PREFIX:
+            return text.size() >= first.size() && equalsLowerAt(text, 0, first);
+        case Kind::SUFFIX:
+            return text.size() >= first.size() && equalsLowerAt(text, text.size() - first.size(), first);
+        case Kind::EXACT:
+            return text.size() == first.size() && equalsLowerAt(text, 0, first);
+        case Kind::GLOB: {
+            if (text.find_first_of("\n\r") != std::string_view::npos) {
+                break;
+            }
+            
+            size_t pos = 0;
+            size_t last = segments_.size() - 1;
+            for (size_t i = 0; i <= last; ++i) {
+                const std::string& segment = segments_[i];
+                if (i == 0 && anchorStart_) {
+                    if (text.size() < segment.size() || !equalsLowerAt(text, 0, segment)) {
+                        return false;
+                    }
+                    pos = segment.size();
+                } else if (i == last && anchorEnd_) {
+                    return text.size() >= pos + segment.size() &&
+                           equalsLowerAt(text, text.size() - segment.size(), segment);
+                } else {
+                    size_t found = findLower(text, segment, pos);
+                    if (found == std::string_view::npos) {
+                        return false;
+                    }
+                    pos = found + segment.size();
+                }
+            }
+            return true;
+        }
+        case Kind::REGEX:
+            break;
+    }
+    
+    return std::regex_search(text.begin(), text.end(), regex_);
+}
+
+CompiledPattern::Kind CompiledPattern::getKind() const {
+    return kind_;
+}
+
+std::shared_ptr<const CompiledPattern> OopParser::getCompiledPattern(const std::string& pattern) const {
+    std::lock_guard<std::mutex> lock(patternCacheMutex_);
+    
+    auto index_it = patternCacheIndex_.find(pattern);
+    if (index_it != patternCacheIndex_.end()) {
+        patternCache_.splice(patternCache_.begin(), patternCache_, index_it->second);
+        return index_it->second->second;
+    }
+    
+    auto compiled = std::make_shared<const CompiledPattern>(pattern);
+    if (patternCacheCapacity_ == 0) {
+        return compiled;
+    }
+    
+    patternCache_.emplace_front(pattern, compiled);
+    patternCacheIndex_[pattern] = patternCache_.begin();
+    while (patternCache_.size() > patternCacheCapacity_) {
+        patternCacheIndex_.erase(patternCache_.back().first);
+        patternCache_.pop_back();
+    }
+    
+    return compiled;
+}
+
+void OopParser::setPatternCacheCapacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(patternCacheMutex_);
+    patternCacheCapacity_ = capacity;
+    while (patternCache_.size() > patternCacheCapacity_) {
+        patternCacheIndex_.erase(patternCache_.back().first);
+        patternCache_.pop_back();
+    }
+}
+
+size_t OopParser::forEachParameterByKeyPattern(
+    const CompiledPattern& pattern,
+    const std::function<void(const ConfigSectionData&, const ConfigParameter&)>& visitor) const {
+    if (!pattern.isValid()) {
+        lastError_ = pattern.getError();
+        return 0;
+    }
+    
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    size_t matches = 0;
+    for (const auto& section : sections_) {
+        for (const auto& [key, param] : section->parameters) {
+            if (pattern.matches(key)) {
+                visitor(*section, param);
+                ++matches;
+            }
+        }
+    }
+    
+    return matches;
+}
+
+size_t OopParser::forEachParameterByValuePattern(
+    const CompiledPattern& pattern,
+    const std::function<void(const ConfigSectionData&, const ConfigParameter&)>& visitor) const {
+    if (!pattern.isValid()) {
+        lastError_ = pattern.getError();
+        return 0;
+    }
+    
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    size_t matches = 0;
+    for (const auto& section : sections_) {
+        for (const auto& [key, param] : section->parameters) {
+            if (pattern.matches(param.value)) {
+                visitor(*section, param);
+                ++matches;
+            }
+        }
+    }
+    
+    return matches;
+}
+
+std::vector<const ConfigParameter*> OopParser::findParametersByKeyPattern(const CompiledPattern& pattern) const {
+    std::vector<const ConfigParameter*> results;
+    forEachParameterByKeyPattern(pattern, [&results](const ConfigSectionData&, const ConfigParameter& param) {
+        results.push_back(&param);
+    });
+    return results;
+}
+
+std::vector<const ConfigParameter*> OopParser::findParametersByKeyPattern(const std::string& pattern) const {
+    return findParametersByKeyPattern(*getCompiledPattern(pattern));
+}
+
+std::vector<const ConfigParameter*> OopParser::findParametersByValuePattern(const CompiledPattern& pattern) const {
+    std::vector<const ConfigParameter*> results;
+    forEachParameterByValuePattern(pattern, [&results](const ConfigSectionData&, const ConfigParameter& param) {
+        results.push_back(&param);
+    });
+    return results;
+}
+
+std::vector<const ConfigParameter*> OopParser::findParametersByValuePattern(const std::string& pattern) const {
+    return findParametersByValuePattern(*getCompiledPattern(pattern));
+}
+
+// Internal helper - assumes lock is already held
+std::vector<size_t> OopParser::partitionSections_unlocked(size_t threads) const {
+    if (threads == 0) {
+        threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+    threads = std::max<size_t>(1, std::min(threads, sections_.size()));
+    
+    size_t total = 0;
+    for (const auto& section : sections_) {
+        total += section->parameters.size();
+    }
+    
+    // Close a chunk once it holds its share of the parameters
+    std::vector<size_t> bounds{0};
+    size_t filled = 0;
+    for (size_t s = 0; s < sections_.size(); ++s) {
+        filled += sections_[s]->parameters.size();
+        size_t remaining_chunks = threads - (bounds.size() - 1);
+        if (remaining_chunks > 1 && s + 1 < sections_.size() &&
+            filled * threads >= total * bounds.size()) {
+            bounds.push_back(s + 1);
+        }
+    }
+    bounds.push_back(sections_.size());
+    return bounds;
+}
+
+namespace {
+
+// Process-wide worker threads for parallel queries and batch validation, so
+// repeated calls do not pay for creating and joining threads
+class WorkerPool {
+public:
+    static WorkerPool& instance() {
+        static WorkerPool pool(std::max<size_t>(1, std::thread::hardware_concurrency()) - 1);
+        return pool;
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wakeup_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    // Run tasks 0..count-1 and wait for them. The caller claims tasks too,
+    // so a call never waits on workers busy with other calls (or nested ones).
+    void run(size_t count, const std::function<void(size_t)>& task) {
+        auto batch = std::make_shared<Batch>(task, count);
+        size_t helpers = std::min(count - 1, workers_.size());
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (size_t i = 0; i < helpers; ++i) {
+                queue_.push_back(batch);
+            }
+        }
+        for (size_t i = 0; i < helpers; ++i) {
+            wakeup_.notify_one();
+        }
+        
+        work(*batch);
+        {
+            std::unique_lock<std::mutex> lock(batch->mutex);
+            batch->done.wait(lock, [&]() { return batch->finished == count; });
+        }
+        for (const auto& error : batch->errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+private:
+    // One run() call; workers holding it after it finished find no task left
+    struct Batch {
+        Batch(const std::function<void(size_t)>& t, size_t n) : task(t), count(n), errors(n) {}
+        const std::function<void(size_t)>& task;
+        const size_t count;
+        std::atomic<size_t> next{0};
+        std::vector<std::exception_ptr> errors;  // Slot i written only by the runner of task i
+        std::mutex mutex;
+        std::condition_variable done;
+        size_t finished = 0;
+    };
+
+    explicit WorkerPool(size_t workers) {
+        workers_.reserve(workers);
+        for (size_t i = 0; i < workers; ++i) {
+            workers_.emplace_back([this]() { loop(); });
+        }
+    }
+
+    static void work(Batch& batch) {
+        for (size_t i = batch.next++; i < batch.count; i = batch.next++) {
+            try {
+                batch.task(i);
+            } catch (...) {
+                batch.errors[i] = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock(batch.mutex);
+            if (++batch.finished == batch.count) {
+                batch.done.notify_all();
+            }
+        }
+    }
+
+    void loop() {
+        for (;;) {
+            std::shared_ptr<Batch> batch;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wakeup_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+                if (queue_.empty()) {
+                    return;  // Stopping
+                }
+                batch = std::move(queue_.front());
+                queue_.pop_front();
+            }
+            work(*batch);
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::deque<std::shared_ptr<Batch>> queue_;  // One entry per worker asked to help
+    std::mutex mutex_;
+    std::condition_variable wakeup_;
+    bool stopping_ = false;
+};
+
+} // namespace
+
+void OopParser::runParallel(size_t count, const std::function<void(size_t)>& task) {
+    if (count <= 1) {
+        if (count == 1) {
+            task(0);
+        }
+        return;
+    }
+    WorkerPool::instance().run(count, task);
+}
+
+std::vector<ConfigParameter> OopParser::getParametersByKeyPattern(const std::string& pattern) const {
+    std::vector<ConfigParameter> results;
+    forEachParameterByKeyPattern(*getCompiledPattern(pattern),
+        [&results](const ConfigSectionData&, const ConfigParameter& param) {
+            results.push_back(param);
+        });
+    return results;
+}
+
+std::vector<ConfigParameter> OopParser::getParametersByValuePattern(const std::string& pattern) const {
+    std::vector<ConfigParameter> results;
+    forEachParameterByValuePattern(*getCompiledPattern(pattern),
+        [&results](const ConfigSectionData&, const ConfigParameter& param) {
+            results.push_back(param);
+        });
+    return results;
+}
+
+// Internal helper - assumes lock is already held
+void OopParser::refreshTypeIndex_unlocked() const {
+    auto unindex = [this](const ConfigSectionData* section, TypeIndexEntry& entry) {
+        for (const auto& [type, keys] : entry.byType) {
+            auto count_it = typeCounts_.find(type);
+            count_it->second -= keys.size();
+            if (count_it->second == 0) {
+                typeCounts_.erase(count_it);
+            }
+            auto sections_it = typeSections_.find(type);
+            sections_it->second.erase(section);
+            if (sections_it->second.empty()) {
+                typeSections_.erase(sections_it);
+            }
+        }
+        entry.byType.clear();
+    };
+    
+    // Sections were added, removed or replaced: resync the index with sections_
+    if (indexedGeneration_ != generation_) {
+        std::unordered_set<const ConfigSectionData*> live;
+        live.reserve(sections_.size());
+        for (const auto& section : sections_) {
+            live.insert(section.get());
+        }
+        for (auto it = typeIndex_.begin(); it != typeIndex_.end();) {
+            if (live.count(it->first) && !it->second.section.expired()) {
+                ++it;
+                continue;
+            }
+            unindex(it->first, it->second);
+            it = typeIndex_.erase(it);
+        }
+        for (size_t i = 0; i < sections_.size(); ++i) {
+            auto [it, inserted] = typeIndex_.try_emplace(sections_[i].get());
+            if (inserted) {
+                it->second.section = sections_[i];
+                typeIndexDirty_.insert(sections_[i].get());
+            }
+            it->second.position = i;
+        }
+        indexedGeneration_ = generation_;
+    }
+    
+    for (const ConfigSectionData* dirty : typeIndexDirty_) {
+        auto it = typeIndex_.find(dirty);
+        if (it == typeIndex_.end()) {
+            continue;  // Removed since it was changed
+        }
+        unindex(dirty, it->second);
+        for (const auto& [key, param] : dirty->parameters) {
+            it->second.byType[param.type].push_back(key);
+        }
+        for (const auto& [type, keys] : it->second.byType) {
+            typeCounts_[type] += keys.size();
+            typeSections_[type].insert(dirty);
+        }
+    }
+    typeIndexDirty_.clear();
+}
+
+// Internal helper - assumes lock is already held
+std::vector<const ConfigSectionData*> OopParser::sectionsWithType_unlocked(std::string_view type) const {
+    std::vector<const ConfigSectionData*> sections;
+    auto sections_it = typeSections_.find(type);
+    if (sections_it == typeSections_.end()) {
+        return sections;
+    }
+    sections.assign(sections_it->second.begin(), sections_it->second.end());
+    std::sort(sections.begin(), sections.end(), [this](const ConfigSectionData* a, const ConfigSectionData* b) {
+        return typeIndex_.find(a)->second.position < typeIndex_.find(b)->second.position;
+    });
+    return sections;
+}
+
+std::vector<const ConfigParameter*> OopParser::findParametersByType(const std::string& type) const {
+    std::vector<const ConfigParameter*> results;
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    refreshTypeIndex_unlocked();
+    
+    auto count_it = typeCounts_.find(type);
+    if (count_it == typeCounts_.end()) {
+        return results;
+    }
+    results.reserve(count_it->second);
+    
+    for (const ConfigSectionData* section : sectionsWithType_unlocked(type)) {
+        forEachIndexedParameter_unlocked(*section, type,
+            [&results](const ConfigParameter& param) { results.push_back(&param); });
+    }
+    
+    return results;
+}
+
+std::vector<ConfigParameter> OopParser::getParametersByType(const std::string& type) const {
+    std::vector<ConfigParameter> results;
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    refreshTypeIndex_unlocked();
+    
+    auto count_it = typeCounts_.find(type);
+    if (count_it == typeCounts_.end()) {
+        return results;
+    }
+    results.reserve(count_it->second);
+    
+    for (const ConfigSectionData* section : sectionsWithType_unlocked(type)) {
+        forEachIndexedParameter_unlocked(*section, type,
+            [&results](const ConfigParameter& param) { results.push_back(param); });
+    }
+    
+    return results;
+}
+
+size_t OopParser::getParameterCountByType(const std::string& type) const {
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    refreshTypeIndex_unlocked();
+    
+    auto count_it = typeCounts_.find(type);
+    return count_it != typeCounts_.end() ? count_it->second : 0;
+}
+
+std::map<std::string, size_t> OopParser::getParameterCountsByType() const {
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    refreshTypeIndex_unlocked();
+    return std::map<std::string, size_t>(typeCounts_.begin(), typeCounts_.end());
+}
+
+// ============ Path-Based Access Implementation (RFC 6901) ============
 
 std::vector<std::string> OopParser::parsePath(const std::string& path) {
     std::vector<std::string> components;
@@ -2541,57 +5131,127 @@ std::string OopParser::unescapePathToken(const std::string& token) {
     return unescaped;
 }
 
-std::string OopParser::getValueByPath(const std::string& path) const {
-    auto components = parsePath(path);
-    std::lock_guard<std::mutex> lock(sectionsMutex_);
+// Split a JSON Pointer into its first two raw tokens without allocating.
+// Returns the number of components (empty tokens are skipped, as in
+// parsePath), or npos if the path does not start with '/'.
+static size_t splitPathTokens(std::string_view path, std::string_view& first,
+                              std::string_view& second) {
+    if (path.empty() || path == "/") {
+        return 0;
+    }
+    if (path[0] != '/') {
+        return std::string_view::npos;
+    }
     
-    // Root path
-    if (components.empty()) {
-        json root_json = json::object();
-        for (const auto& section : sections_) {
-            json section_obj = json::object();
-            for (const auto& [key, param] : section.parameters) {
-                section_obj[key] = param.value;
+    size_t count = 0;
+    size_t start = 1;
+    for (size_t pos = 1; pos <= path.size(); ++pos) {
+        if (pos == path.size() || path[pos] == '/') {
+            if (pos > start) {
+                if (count == 0) {
+                    first = path.substr(start, pos - start);
+                } else if (count == 1) {
+                    second = path.substr(start, pos - start);
+                }
+                count++;
             }
-            root_json[section.name] = section_obj;
+            start = pos + 1;
         }
-        return root_json.dump();
     }
-    
-    // Find section
-    if (components.size() >= 1) {
-        auto section_it = std::find_if(sections_.begin(), sections_.end(),
-            [&](const ConfigSectionData& s) { return s.name == components[0]; });
-        
-        if (section_it == sections_.end()) {
-            return "";  // Section not found
-        }
-        
-        // If only section requested
-        if (components.size() == 1) {
-            json section_obj = json::object();
-            for (const auto& [key, param] : section_it->parameters) {
-                section_obj[key] = param.value;
-            }
-            return section_obj.dump();
+    return count;
+}
+
+// Compare a raw path token with a name, decoding ~0 and ~1 on the fly
+static bool pathTokenEquals(std::string_view token, std::string_view name) {
+    size_t j = 0;
+    for (size_t i = 0; i < token.size(); ++i, ++j) {
+        char c = token[i];
+        if (c == '~' && i + 1 < token.size() && (token[i + 1] == '0' || token[i + 1] == '1')) {
+            c = token[i + 1] == '0' ? '~' : '/';
+            ++i;
         }
-        
-        // Find parameter
-        if (components.size() >= 2) {
-            auto param_it = section_it->parameters.find(components[1]);
-            if (param_it != section_it->parameters.end()) {
-                return param_it->second.value;
-            }
+        if (j >= name.size() || name[j] != c) {
+            return false;
         }
     }
-    
-    return "";
+    return j == name.size();
 }
 
-bool OopParser::setValueByPath(const std::string& path, const std::string& value) {
-    auto components = parsePath(path);
-    
-    if (components.empty() || components.size() < 2) {
+// Internal helper - assumes lock is already held
+const ConfigSectionData* OopParser::findPathSection_unlocked(std::string_view token) const {
+    for (const auto& section : sections_) {
+        if (pathTokenEquals(token, section->name)) {
+            return section.get();
+        }
+    }
+    return nullptr;
+}
+
+// Internal helper - assumes lock is already held
+const ConfigParameter* OopParser::findPathParameter_unlocked(std::string_view sectionToken,
+                                                             std::string_view keyToken) const {
+    const ConfigSectionData* section = findPathSection_unlocked(sectionToken);
+    if (!section) {
+        return nullptr;
+    }
+    
+    // Escaped keys are rare; only they need a decoded copy
+    auto param_it = keyToken.find('~') == std::string_view::npos
+        ? section->parameters.find(keyToken)
+        : section->parameters.find(unescapePathToken(std::string(keyToken)));
+    return param_it != section->parameters.end() ? &param_it->second : nullptr;
+}
+
+std::string OopParser::getValueByPath(const std::string& path) const {
+    std::string_view first, second;
+    size_t depth = splitPathTokens(path, first, second);
+    if (depth == 0 || depth == std::string_view::npos || depth == 1) {
+        return dumpByPath(path);
+    }
+    
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    const ConfigParameter* param = findPathParameter_unlocked(first, second);
+    return param ? param->value : "";
+}
+
+std::string OopParser::dumpByPath(const std::string& path) const {
+    std::string_view first, second;
+    size_t depth = splitPathTokens(path, first, second);
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    
+    // Root path (paths without a leading '/' are treated as root)
+    if (depth == 0 || depth == std::string_view::npos) {
+        json root_json = json::object();
+        for (const auto& section : sections_) {
+            json section_obj = json::object();
+            for (const auto& [key, param] : section->parameters) {
+                section_obj[key] = param.value;
+            }
+            root_json[section->name] = section_obj;
+        }
+        return root_json.dump();
+    }
+    
+    if (depth == 1) {
+        const ConfigSectionData* section = findPathSection_unlocked(first);
+        if (!section) {
+            return "";  // Section not found
+        }
+        json section_obj = json::object();
+        for (const auto& [key, param] : section->parameters) {
+            section_obj[key] = param.value;
+        }
+        return section_obj.dump();
+    }
+    
+    const ConfigParameter* param = findPathParameter_unlocked(first, second);
+    return param ? param->value : "";
+}
+
+bool OopParser::setValueByPath(const std::string& path, const std::string& value) {
+    auto components = parsePath(path);
+    
+    if (components.empty() || components.size() < 2) {
         lastError_ = "Path must have at least section and key";
         return false;
     }
@@ -2600,14 +5260,15 @@ bool OopParser::setValueByPath(const std::string& path, const std::string& value
     
     // Find or create section
     auto section_it = std::find_if(sections_.begin(), sections_.end(),
-        [&](const ConfigSectionData& s) { return s.name == components[0]; });
+        [&](const auto& s) { return s->name == components[0]; });
     
     if (section_it == sections_.end()) {
         // Create new section
         ConfigSectionData new_section;
         new_section.name = components[0];
         new_section.type = ConfigSectionData::stringToSectionType(components[0]);
-        sections_.push_back(new_section);
+        sections_.push_back(std::make_shared<ConfigSectionData>(new_section));
+        bumpGeneration();
         section_it = sections_.end() - 1;
     }
     
@@ -2617,13 +5278,648 @@ bool OopParser::setValueByPath(const std::string& path, const std::string& value
     param.value = value;
     param.type = detectType(value);
     
-    section_it->parameters[components[1]] = param;
+    ConfigSectionData& section = detachSection(*section_it);
+    if (section.parameters.count(components[1]) == 0) {
+        bumpGeneration();
+    }
+    section.parameters[components[1]] = param;
     
     return true;
 }
 
+std::vector<PathResult> OopParser::getValuesByPaths(const std::vector<std::string>& paths) const {
+    std::vector<PathResult> results(paths.size());
+    
+    // Split paths and order them by section token so equal sections are adjacent
+    std::vector<std::pair<std::string_view, std::string_view>> tokens(paths.size());
+    std::vector<size_t> order;
+    order.reserve(paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+        size_t depth = splitPathTokens(paths[i], tokens[i].first, tokens[i].second);
+        if (depth == 0 || depth == 1 || depth == std::string_view::npos) {
+            results[i].status = PathStatus::INVALID_PATH;
+            continue;
+        }
+        order.push_back(i);
+    }
+    std::sort(order.begin(), order.end(),
+              [&](size_t a, size_t b) { return tokens[a].first < tokens[b].first; });
+    
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    const ConfigSectionData* section = nullptr;
+    for (size_t n = 0; n < order.size(); ++n) {
+        size_t i = order[n];
+        if (n == 0 || tokens[i].first != tokens[order[n - 1]].first) {
+            section = findPathSection_unlocked(tokens[i].first);
+        }
+        if (!section) {
+            continue;  // NOT_FOUND
+        }
+        
+        std::string_view key = tokens[i].second;
+        auto param_it = key.find('~') == std::string_view::npos
+            ? section->parameters.find(key)
+            : section->parameters.find(unescapePathToken(std::string(key)));
+        if (param_it != section->parameters.end()) {
+            results[i].status = PathStatus::OK;
+            results[i].value = param_it->second.value;
+        }
+    }
+    
+    return results;
+}
+
+std::vector<PathStatus> OopParser::setValuesByPaths(
+    const std::vector<std::pair<std::string, std::string>>& updates) {
+    std::vector<PathStatus> status(updates.size(), PathStatus::INVALID_PATH);
+    
+    // Parse every path before taking the lock
+    std::vector<std::vector<std::string>> components(updates.size());
+    std::vector<size_t> order;
+    order.reserve(updates.size());
+    for (size_t i = 0; i < updates.size(); ++i) {
+        components[i] = parsePath(updates[i].first);
+        if (components[i].size() >= 2) {
+            order.push_back(i);
+        }
+    }
+    if (order.size() < updates.size()) {
+        lastError_ = "Path must have at least section and key";
+    }
+    
+    // Stable so repeated paths are applied in input order
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t a, size_t b) { return components[a][0] < components[b][0]; });
+    
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    bool layoutChanged = false;
+    ConfigSectionData* section = nullptr;
+    for (size_t n = 0; n < order.size(); ++n) {
+        size_t i = order[n];
+        const std::string& section_name = components[i][0];
+        const std::string& key = components[i][1];
+        bool created = false;
+        
+        if (n == 0 || section_name != components[order[n - 1]][0]) {
+            auto section_it = std::find_if(sections_.begin(), sections_.end(),
+                [&](const auto& s) { return s->name == section_name; });
+            if (section_it == sections_.end()) {
+                ConfigSectionData new_section;
+                new_section.name = section_name;
+                new_section.type = ConfigSectionData::stringToSectionType(section_name);
+                sections_.push_back(std::make_shared<ConfigSectionData>(new_section));
+                section_it = sections_.end() - 1;
+                layoutChanged = true;
+                created = true;
+            }
+            section = &detachSection(*section_it);
+        }
+        
+        auto [param_it, inserted] = section->parameters.try_emplace(key);
+        ConfigParameter& param = param_it->second;
+        param.key = key;
+        param.value = updates[i].second;
+        param.type = detectType(param.value);
+        layoutChanged = layoutChanged || inserted;
+        status[i] = (created || inserted) ? PathStatus::CREATED : PathStatus::OK;
+    }
+    
+    if (layoutChanged) {
+        bumpGeneration();
+    }
+    
+    return status;
+}
+
+std::vector<PathStatus> OopParser::setValuesByPaths(const std::map<std::string, std::string>& updates) {
+    return setValuesByPaths(std::vector<std::pair<std::string, std::string>>(updates.begin(), updates.end()));
+}
+
 bool OopParser::hasPath(const std::string& path) const {
-    return !getValueByPath(path).empty();
+    std::string_view first, second;
+    size_t depth = splitPathTokens(path, first, second);
+    if (depth == std::string_view::npos) {
+        return false;
+    }
+    if (depth == 0) {
+        return true;  // Root
+    }
+    
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    if (depth == 1) {
+        return findPathSection_unlocked(first) != nullptr;
+    }
+    return findPathParameter_unlocked(first, second) != nullptr;
+}
+
+// Parse a whole value as double (surrounding blanks allowed, Fortran D exponent accepted)
+static bool parseDoubleValue(const std::string& text, double& value) {
+    const char* begin = text.c_str();
+    char* end = nullptr;
+    double parsed = std::strtod(begin, &end);
+    if (end == begin) {
+        return false;
+    }
+    
+    if (*end == 'd' || *end == 'D') {
+        // Rewrite "1.0D-10" as "1.0E-10" in a stack buffer
+        char buffer[64];
+        if (text.size() >= sizeof(buffer)) {
+            return false;
+        }
+        std::memcpy(buffer, begin, text.size() + 1);
+        buffer[end - begin] = 'E';
+        parsed = std::strtod(buffer, &end);
+        end = const_cast<char*>(begin) + (end - buffer);
+    }
+    
+    while (*end == ' ' || *end == '\t') {
+        ++end;
+    }
+    if (*end != '\0') {
+        return false;
+    }
+    value = parsed;
+    return true;
+}
+
+// Parse a whole value as int (surrounding blanks allowed)
+static bool parseIntValue(const std::string& text, int& value) {
+    const char* begin = text.c_str();
+    char* end = nullptr;
+    errno = 0;
+    long long parsed = std::strtoll(begin, &end, 10);
+    if (end == begin || errno == ERANGE ||
+        parsed < std::numeric_limits<int>::min() || parsed > std::numeric_limits<int>::max()) {
+        return false;
+    }
+    while (*end == ' ' || *end == '\t') {
+        ++end;
+    }
+    if (*end != '\0') {
+        return false;
+    }
+    value = static_cast<int>(parsed);
+    return true;
+}
+
+// Parse a boolean literal (.TRUE./true/yes/1 and their negations, case-insensitive)
+static bool parseBoolValue(const std::string& text, bool& value) {
+    std::string_view view(text);
+    while (!view.empty() && std::isspace(static_cast<unsigned char>(view.front()))) {
+        view.remove_prefix(1);
+    }
+    while (!view.empty() && std::isspace(static_cast<unsigned char>(view.back()))) {
+        view.remove_suffix(1);
+    }
+    
+    auto equalsIgnoreCase = [view](std::string_view literal) {
+        return view.size() == literal.size() &&
+               std::equal(view.begin(), view.end(), literal.begin(), [](char a, char b) {
+                   return std::tolower(static_cast<unsigned char>(a)) == b;
+               });
+    };
+    for (std::string_view literal : {".true.", "true", "yes", "1"}) {
+        if (equalsIgnoreCase(literal)) {
+            value = true;
+            return true;
+        }
+    }
+    for (std::string_view literal : {".false.", "false", "no", "0"}) {
+        if (equalsIgnoreCase(literal)) {
+            value = false;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Give a parameter its declared type if the value parses as that type
+static bool applyDeclaredType(const std::string& type, ConfigParameter& param) {
+    bool parses = false;
+    if (type == "int") {
+        int value = 0;
+        parses = parseIntValue(param.value, value);
+    } else if (type == "float") {
+        double value = 0.0;
+        parses = parseDoubleValue(param.value, value);
+    } else if (type == "bool") {
+        bool value = false;
+        parses = parseBoolValue(param.value, value);
+    } else if (type == "array") {
+        std::string_view view(param.value);
+        size_t first = view.find_first_not_of(" \t");
+        size_t last = view.find_last_not_of(" \t");
+        parses = first != std::string_view::npos && view[first] == '[' && view[last] == ']';
+    } else {
+        parses = type == "string";
+    }
+    if (parses) {
+        param.type = type;
+    }
+    return parses;
+}
+
+// ============ Query Expressions ============
+
+namespace {
+
+// Tokenizer for query expressions
+struct QueryToken {
+    enum class Kind { WORD, QUOTED, OP, LPAREN, RPAREN, END } kind;
+    std::string text;
+    size_t pos;
+};
+
+bool tokenizeQuery(const std::string& text, std::vector<QueryToken>& tokens, std::string& error) {
+    size_t i = 0;
+    while (true) {
+        while (i < text.size() && std::isspace(static_cast<unsigned char>(text[i]))) {
+            ++i;
+        }
+        if (i >= text.size()) {
+            tokens.push_back({QueryToken::Kind::END, "", i});
+            return true;
+        }
+        
+        char c = text[i];
+        size_t start = i;
+        if (c == '(' || c == ')') {
+            tokens.push_back({c == '(' ? QueryToken::Kind::LPAREN : QueryToken::Kind::RPAREN, "", start});
+            ++i;
+        } else if (c == '\'' || c == '"') {
+            size_t end = text.find(c, i + 1);
+            if (end == std::string::npos) {
+                error = "Unterminated quote at position " + std::to_string(start);
+                return false;
+            }
+            tokens.push_back({QueryToken::Kind::QUOTED, text.substr(i + 1, end - i - 1), start});
+            i = end + 1;
+        } else if (std::strchr("=!<>~", c)) {
+            size_t len = (i + 1 < text.size() && text[i + 1] == '=' && c != '=' && c != '~') ? 2 : 1;
+            tokens.push_back({QueryToken::Kind::OP, text.substr(i, len), start});
+            i += len;
+        } else {
+            while (i < text.size() && !std::isspace(static_cast<unsigned char>(text[i])) &&
+                   !std::strchr("()=!<>~'\"", text[i])) {
+                ++i;
+            }
+            tokens.push_back({QueryToken::Kind::WORD, text.substr(start, i - start), start});
+        }
+    }
+}
+
+bool isQueryKeyword(const QueryToken& token, const char* keyword) {
+    if (token.kind != QueryToken::Kind::WORD || token.text.size() != std::strlen(keyword)) {
+        return false;
+    }
+    for (size_t i = 0; i < token.text.size(); ++i) {
+        if (std::toupper(static_cast<unsigned char>(token.text[i])) != keyword[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+// Parse a whole value as double (defined with the typed path getters)
+static bool parseDoubleValue(const std::string& text, double& value);
+
+/// Recursive-descent parser producing ConfigQuery nodes
+class ConfigQueryParser {
+public:
+    ConfigQueryParser(const std::vector<QueryToken>& tokens, std::vector<ConfigQuery::Node>& nodes)
+        : tokens_(tokens), nodes_(nodes) {}
+    
+    bool parse(size_t& root, std::string& error) {
+        if (!parseOr(root, error)) {
+            return false;
+        }
+        if (tokens_[pos_].kind != QueryToken::Kind::END) {
+            error = "Unexpected token at position " + std::to_string(tokens_[pos_].pos);
+            return false;
+        }
+        return true;
+    }
+
+private:
+    using Node = ConfigQuery::Node;
+    
+    const std::vector<QueryToken>& tokens_;
+    std::vector<Node>& nodes_;
+    size_t pos_ = 0;
+    
+    size_t addBinary(Node::Kind kind, size_t left, size_t right) {
+        Node node;
+        node.kind = kind;
+        node.left = left;
+        node.right = right;
+        nodes_.push_back(std::move(node));
+        return nodes_.size() - 1;
+    }
+    
+    bool parseOr(size_t& out, std::string& error) {
+        if (!parseAnd(out, error)) {
+            return false;
+        }
+        while (isQueryKeyword(tokens_[pos_], "OR")) {
+            ++pos_;
+            size_t right;
+            if (!parseAnd(right, error)) {
+                return false;
+            }
+            out = addBinary(Node::Kind::OR, out, right);
+        }
+        return true;
+    }
+    
+    bool parseAnd(size_t& out, std::string& error) {
+        if (!parseFactor(out, error)) {
+            return false;
+        }
+        while (isQueryKeyword(tokens_[pos_], "AND")) {
+            ++pos_;
+            size_t right;
+            if (!parseFactor(right, error)) {
+                return false;
+            }
+            out = addBinary(Node::Kind::AND, out, right);
+        }
+        return true;
+    }
+    
+    bool parseFactor(size_t& out, std::string& error) {
+        const QueryToken& token = tokens_[pos_];
+        if (isQueryKeyword(token, "NOT")) {
+            ++pos_;
+            size_t operand;
+            if (!parseFactor(operand, error)) {
+                return false;
+            }
+            out = addBinary(Node::Kind::NOT, operand, 0);
+            return true;
+        }
+        if (token.kind == QueryToken::Kind::LPAREN) {
+            ++pos_;
+            if (!parseOr(out, error)) {
+                return false;
+            }
+            if (tokens_[pos_].kind != QueryToken::Kind::RPAREN) {
+                error = "Expected ')' at position " + std::to_string(tokens_[pos_].pos);
+                return false;
+            }
+            ++pos_;
+            return true;
+        }
+        return parseComparison(out, error);
+    }
+    
+    bool parseComparison(size_t& out, std::string& error) {
+        Node node;
+        node.kind = Node::Kind::COMPARE;
+        
+        const QueryToken& field = tokens_[pos_];
+        if (isQueryKeyword(field, "SECTION")) {
+            node.field = ConfigQuery::Field::SECTION;
+        } else if (isQueryKeyword(field, "KEY")) {
+            node.field = ConfigQuery::Field::KEY;
+        } else if (isQueryKeyword(field, "VALUE")) {
+            node.field = ConfigQuery::Field::VALUE;
+        } else if (isQueryKeyword(field, "TYPE")) {
+            node.field = ConfigQuery::Field::TYPE;
+        } else {
+            error = "Expected section, key, value or type at position " + std::to_string(field.pos);
+            return false;
+        }
+        ++pos_;
+        
+        const QueryToken& op = tokens_[pos_];
+        static const std::map<std::string, ConfigQuery::Op> ops = {
+            {"=", ConfigQuery::Op::EQ}, {"!=", ConfigQuery::Op::NE}, {"<", ConfigQuery::Op::LT},
+            {"<=", ConfigQuery::Op::LE}, {">", ConfigQuery::Op::GT}, {">=", ConfigQuery::Op::GE},
+            {"~", ConfigQuery::Op::MATCH}
+        };
+        auto op_it = op.kind == QueryToken::Kind::OP ? ops.find(op.text) : ops.end();
+        if (op_it == ops.end()) {
+            error = "Expected comparison operator at position " + std::to_string(op.pos);
+            return false;
+        }
+        node.op = op_it->second;
+        ++pos_;
+        
+        const QueryToken& literal = tokens_[pos_];
+        if (literal.kind != QueryToken::Kind::WORD && literal.kind != QueryToken::Kind::QUOTED) {
+            error = "Expected value at position " + std::to_string(literal.pos);
+            return false;
+        }
+        node.literal = literal.text;
+        node.isNumber = parseDoubleValue(node.literal, node.number);
+        ++pos_;
+        
+        if (node.op == ConfigQuery::Op::MATCH) {
+            node.pattern = std::make_shared<const CompiledPattern>(node.literal);
+            if (!node.pattern->isValid()) {
+                error = node.pattern->getError();
+                return false;
+            }
+        }
+        
+        nodes_.push_back(std::move(node));
+        out = nodes_.size() - 1;
+        return true;
+    }
+};
+
+ConfigQuery::ConfigQuery(const std::string& expression)
+    : expression_(expression), root_(0), hasSectionFilter_(false), impossible_(false) {
+    std::vector<QueryToken> tokens;
+    if (!tokenizeQuery(expression, tokens, error_) ||
+        !ConfigQueryParser(tokens, nodes_).parse(root_, error_)) {
+        if (error_.empty()) {
+            error_ = "Invalid query";
+        }
+        nodes_.clear();
+        return;
+    }
+    planIndexes();
+}
+
+void ConfigQuery::planIndexes() {
+    // Collect comparisons reachable from the root through AND nodes only
+    std::vector<size_t> pending{root_};
+    while (!pending.empty()) {
+        const Node& node = nodes_[pending.back()];
+        pending.pop_back();
+        if (node.kind == Node::Kind::AND) {
+            pending.push_back(node.left);
+            pending.push_back(node.right);
+            continue;
+        }
+        if (node.kind != Node::Kind::COMPARE || node.op != Op::EQ) {
+            continue;
+        }
+        
+        if (node.field == Field::SECTION) {
+            if (!hasSectionFilter_) {
+                hasSectionFilter_ = true;
+                sections_.push_back(node.literal);
+            } else if (std::find(sections_.begin(), sections_.end(), node.literal) == sections_.end()) {
+                impossible_ = true;  // Two different sections
+            }
+        } else if (node.field == Field::TYPE) {
+            if (typeFilter_.empty()) {
+                typeFilter_ = node.literal;
+            } else if (typeFilter_ != node.literal) {
+                impossible_ = true;
+            }
+        }
+    }
+}
+
+const std::string& ConfigQuery::getExpression() const {
+    return expression_;
+}
+
+bool ConfigQuery::isValid() const {
+    return error_.empty();
+}
+
+const std::string& ConfigQuery::getError() const {
+    return error_;
+}
+
+bool ConfigQuery::matches(const ConfigSectionData& section, const ConfigParameter& param) const {
+    return isValid() && evaluate(root_, section, param);
+}
+
+bool ConfigQuery::evaluate(size_t index, const ConfigSectionData& section, const ConfigParameter& param) const {
+    const Node& node = nodes_[index];
+    switch (node.kind) {
+        case Node::Kind::AND:
+            return evaluate(node.left, section, param) && evaluate(node.right, section, param);
+        case Node::Kind::OR:
+            return evaluate(node.left, section, param) || evaluate(node.right, section, param);
+        case Node::Kind::NOT:
+            return !evaluate(node.left, section, param);
+        case Node::Kind::COMPARE:
+            break;
+    }
+    
+    const std::string& text = node.field == Field::SECTION ? section.name
+                            : node.field == Field::KEY ? param.key
+                            : node.field == Field::TYPE ? param.type
+                            : param.value;
+    if (node.op == Op::MATCH) {
+        return node.pattern->matches(text);
+    }
+    
+    // Values compare as numbers when the literal is one; ordering needs numbers
+    int order;
+    double number;
+    if (node.field == Field::VALUE && node.isNumber && parseDoubleValue(text, number)) {
+        order = number < node.number ? -1 : (number > node.number ? 1 : 0);
+    } else if (node.field == Field::VALUE && node.op != Op::EQ && node.op != Op::NE) {
+        return false;
+    } else {
+        order = text.compare(node.literal);
+    }
+    
+    switch (node.op) {
+        case Op::EQ: return order == 0;
+        case Op::NE: return order != 0;
+        case Op::LT: return order < 0;
+        case Op::LE: return order <= 0;
+        case Op::GT: return order > 0;
+        case Op::GE: return order >= 0;
+        case Op::MATCH: break;
+    }
+    return false;
+}
+
+size_t OopParser::queryParameters(
+    const ConfigQuery& query,
+    const std::function<void(const ConfigSectionData&, const ConfigParameter&)>& visitor) const {
+    if (!query.isValid()) {
+        lastError_ = query.getError();
+        return 0;
+    }
+    if (query.impossible_) {
+        return 0;
+    }
+    
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    size_t matches = 0;
+    
+    // A type filter only visits sections the type index lists for it
+    if (!query.typeFilter_.empty()) {
+        refreshTypeIndex_unlocked();
+        for (const ConfigSectionData* section : sectionsWithType_unlocked(query.typeFilter_)) {
+            if (query.hasSectionFilter_ && section->name != query.sections_.front()) {
+                continue;
+            }
+            forEachIndexedParameter_unlocked(*section, query.typeFilter_, [&](const ConfigParameter& param) {
+                if (query.evaluate(query.root_, *section, param)) {
+                    visitor(*section, param);
+                    ++matches;
+                }
+            });
+        }
+        return matches;
+    }
+    
+    for (const auto& section : sections_) {
+        if (query.hasSectionFilter_ && section->name != query.sections_.front()) {
+            continue;
+        }
+        
+        for (const auto& [key, param] : section->parameters) {
+            if (query.evaluate(query.root_, *section, param)) {
+                visitor(*section, param);
+                ++matches;
+            }
+        }
+    }
+    
+    return matches;
+}
+
+std::vector<const ConfigParameter*> OopParser::queryParameters(const std::string& expression) const {
+    std::vector<const ConfigParameter*> results;
+    queryParameters(ConfigQuery(expression), [&results](const ConfigSectionData&, const ConfigParameter& param) {
+        results.push_back(&param);
+    });
+    return results;
+}
+
+bool OopParser::getDoubleByPath(const std::string& path, double& value) const {
+    std::string_view first, second;
+    if (splitPathTokens(path, first, second) < 2) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    const ConfigParameter* param = findPathParameter_unlocked(first, second);
+    return param && parseDoubleValue(param->value, value);
+}
+
+bool OopParser::getIntByPath(const std::string& path, int& value) const {
+    std::string_view first, second;
+    if (splitPathTokens(path, first, second) < 2) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    const ConfigParameter* param = findPathParameter_unlocked(first, second);
+    return param && parseIntValue(param->value, value);
+}
+
+bool OopParser::getBoolByPath(const std::string& path, bool& value) const {
+    std::string_view first, second;
+    if (splitPathTokens(path, first, second) < 2) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    const ConfigParameter* param = findPathParameter_unlocked(first, second);
+    return param && parseBoolValue(param->value, value);
 }
 
 bool OopParser::deleteByPath(const std::string& path) {
@@ -2638,49 +5934,373 @@ bool OopParser::deleteByPath(const std::string& path) {
     
     // Find section
     auto section_it = std::find_if(sections_.begin(), sections_.end(),
-        [&](const ConfigSectionData& s) { return s.name == components[0]; });
+        [&](const auto& s) { return s->name == components[0]; });
     
     if (section_it == sections_.end()) {
         lastError_ = "Section not found: " + components[0];
         return false;
     }
     
-    if (components.size() == 1) {
-        // Delete entire section
-        sections_.erase(section_it);
-        return true;
+    if (components.size() == 1) {
+        // Delete entire section
+        sections_.erase(section_it);
+        bumpGeneration();
+        return true;
+    }
+    
+    if (components.size() >= 2) {
+        // Delete parameter
+        if ((*section_it)->parameters.count(components[1]) > 0) {
+            detachSection(*section_it).parameters.erase(components[1]);
+            bumpGeneration();
+            return true;
+        }
+    }
+    
+    lastError_ = "Path not found: " + path;
+    return false;
+}
+
+std::vector<std::string> OopParser::getAllPaths() const {
+    std::vector<std::string> paths;
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    
+    for (const auto& section : sections_) {
+        // Add section path
+        paths.push_back("/" + escapePathToken(section->name));
+        
+        // Add parameter paths
+        for (const auto& [key, param] : section->parameters) {
+            std::string param_path = "/" + escapePathToken(section->name) + 
+                                     "/" + escapePathToken(key);
+            paths.push_back(param_path);
+        }
+    }
+    
+    return paths;
+}
+
+// Match one name against a glob component (*, ?, [...] classes)
+static bool matchGlob(std::string_view pattern, std::string_view text) {
+    size_t p = 0, t = 0;
+    size_t star_p = std::string_view::npos, star_t = 0;
+    
+    while (t < text.size()) {
+        if (p < pattern.size() && pattern[p] == '*') {
+            star_p = ++p;
+            star_t = t;
+            continue;
+        }
+        
+        bool matched = false;
+        size_t next_p = p + 1;
+        if (p < pattern.size()) {
+            if (pattern[p] == '?') {
+                matched = true;
+            } else if (pattern[p] == '[') {
+                size_t q = p + 1;
+                bool negate = q < pattern.size() && (pattern[q] == '!' || pattern[q] == '^');
+                if (negate) {
+                    ++q;
+                }
+                bool in_class = false;
+                size_t first = q;
+                while (q < pattern.size() && (pattern[q] != ']' || q == first)) {
+                    if (q + 2 < pattern.size() && pattern[q + 1] == '-' && pattern[q + 2] != ']') {
+                        in_class = in_class || (text[t] >= pattern[q] && text[t] <= pattern[q + 2]);
+                        q += 3;
+                    } else {
+                        in_class = in_class || text[t] == pattern[q];
+                        ++q;
+                    }
+                }
+                if (q < pattern.size()) {
+                    matched = in_class != negate;
+                    next_p = q + 1;
+                } else {
+                    matched = text[t] == '[';  // Unterminated class is a literal '['
+                }
+            } else {
+                matched = pattern[p] == text[t];
+            }
+        }
+        
+        if (matched) {
+            p = next_p;
+            ++t;
+        } else if (star_p != std::string_view::npos) {
+            p = star_p;
+            t = ++star_t;
+        } else {
+            return false;
+        }
+    }
+    
+    while (p < pattern.size() && pattern[p] == '*') {
+        ++p;
+    }
+    return p == pattern.size();
+}
+
+// Length of the wildcard-free prefix of a glob component
+static size_t globLiteralPrefix(std::string_view pattern) {
+    size_t pos = pattern.find_first_of("*?[");
+    return pos == std::string_view::npos ? pattern.size() : pos;
+}
+
+// Glob path pattern as a tiny NFA over components; states are pattern indexes
+namespace {
+struct GlobPathPattern {
+    std::vector<std::string> components;
+    
+    bool isDoubleStar(size_t i) const { return components[i] == "**"; }
+    
+    // Add i and every state reachable by skipping "**" components
+    void closure(size_t i, std::vector<size_t>& states) const {
+        while (true) {
+            if (std::find(states.begin(), states.end(), i) == states.end()) {
+                states.push_back(i);
+            }
+            if (i >= components.size() || !isDoubleStar(i)) {
+                return;
+            }
+            ++i;
+        }
+    }
+    
+    std::vector<size_t> advance(const std::vector<size_t>& states, std::string_view name) const {
+        std::vector<size_t> next;
+        for (size_t i : states) {
+            if (i >= components.size()) {
+                continue;
+            }
+            if (isDoubleStar(i)) {
+                closure(i, next);
+            } else if (matchGlob(components[i], name)) {
+                closure(i + 1, next);
+            }
+        }
+        return next;
+    }
+    
+    bool accepts(const std::vector<size_t>& states) const {
+        return std::find(states.begin(), states.end(), components.size()) != states.end();
+    }
+};
+}  // namespace
+
+size_t OopParser::findPaths(const std::string& pattern,
+                            const std::function<bool(const std::string& path,
+                                                     const ConfigSectionData& section,
+                                                     const ConfigParameter* param)>& callback) const {
+    GlobPathPattern glob{parsePath(pattern)};
+    if (glob.components.empty()) {
+        return 0;
+    }
+    
+    std::vector<size_t> start;
+    glob.closure(0, start);
+    
+    // A literal section component is a plain name comparison with fixed states
+    const std::string& first = glob.components.front();
+    const bool literal_section = !glob.isDoubleStar(0) && globLiteralPrefix(first) == first.size();
+    const std::vector<size_t> literal_states = literal_section ? glob.advance(start, first) : std::vector<size_t>();
+    
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    size_t matches = 0;
+    std::string path;
+    
+    for (const auto& section : sections_) {
+        if (literal_section && section->name != first) {
+            continue;
+        }
+        std::vector<size_t> states = literal_section ? literal_states : glob.advance(start, section->name);
+        if (states.empty()) {
+            continue;
+        }
+        
+        path = "/" + escapePathToken(section->name);
+        if (glob.accepts(states)) {
+            ++matches;
+            if (!callback(path, *section, nullptr)) {
+                return matches;
+            }
+        }
+        
+        // Parameters need one more component: keep states that can still accept
+        std::vector<size_t> live;
+        for (size_t i : states) {
+            if (i < glob.components.size()) {
+                live.push_back(i);
+            }
+        }
+        if (live.empty()) {
+            continue;
+        }
+        
+        const size_t prefix_len = path.size();
+        auto emit = [&](const std::string& key, const ConfigParameter& param) {
+            path.resize(prefix_len);
+            path += '/';
+            path += escapePathToken(key);
+            ++matches;
+            return callback(path, *section, &param);
+        };
+        
+        // A single non-"**" final component can use the key index
+        bool indexed = live.size() == 1 && live[0] + 1 == glob.components.size() &&
+                       !glob.isDoubleStar(live[0]);
+        if (indexed) {
+            const std::string& component = glob.components[live[0]];
+            size_t literal = globLiteralPrefix(component);
+            if (literal == component.size()) {
+                auto it = section->parameters.find(component);
+                if (it != section->parameters.end() && !emit(it->first, it->second)) {
+                    return matches;
+                }
+                continue;
+            }
+            
+            std::string_view prefix(component.data(), literal);
+            for (auto it = section->parameters.lower_bound(prefix);
+                 it != section->parameters.end() && it->first.compare(0, literal, prefix) == 0; ++it) {
+                if (matchGlob(component, it->first) && !emit(it->first, it->second)) {
+                    return matches;
+                }
+            }
+            continue;
+        }
+        
+        for (const auto& [key, param] : section->parameters) {
+            if (glob.accepts(glob.advance(live, key)) && !emit(key, param)) {
+                return matches;
+            }
+        }
+    }
+    
+    return matches;
+}
+
+// ============ Compiled Path Access ============
+
+static uint64_t nextPathHandleId() {
+    static std::atomic<uint64_t> counter{0};
+    return ++counter;
+}
+
+PathHandle::PathHandle()
+    : path_("/"), id_(nextPathHandleId()) {}
+
+PathHandle::PathHandle(const std::string& path)
+    : path_(path), components_(OopParser::parsePath(path)), id_(nextPathHandleId()) {}
+
+const std::string& PathHandle::getPath() const {
+    return path_;
+}
+
+const std::vector<std::string>& PathHandle::getComponents() const {
+    return components_;
+}
+
+bool PathHandle::isParameterPath() const {
+    return components_.size() >= 2;
+}
+
+// Internal helper - assumes lock is already held
+ConfigParameter* OopParser::resolvePath_unlocked(const PathHandle& handle, size_t& sectionIndex) const {
+    auto slot_it = pathSlots_.find(handle.id_);
+    if (slot_it == pathSlots_.end()) {
+        if (pathSlots_.size() >= kMaxPathSlots) {
+            pathSlots_.clear();  // Mostly handles that no longer exist
+        }
+        slot_it = pathSlots_.emplace(handle.id_, PathSlot()).first;
+    }
+    PathSlot& slot = slot_it->second;
+    
+    // Re-resolve after layout changes, or if the section was renamed through a pointer
+    const std::string& sectionName = handle.components_[0];
+    if (slot.generation != generation_ ||
+        (slot.sectionIndex < sections_.size() && sections_[slot.sectionIndex]->name != sectionName)) {
+        slot.generation = generation_;
+        slot.sectionIndex = sections_.size();
+        for (size_t i = 0; i < sections_.size(); ++i) {
+            if (sections_[i]->name == sectionName) {
+                slot.sectionIndex = i;
+                break;
+            }
+        }
+    }
+    
+    sectionIndex = slot.sectionIndex;
+    if (sectionIndex == sections_.size()) {
+        return nullptr;
+    }
+    auto& parameters = sections_[sectionIndex]->parameters;
+    auto param_it = parameters.find(handle.components_[1]);
+    return param_it != parameters.end() ? &param_it->second : nullptr;
+}
+
+std::string OopParser::getValueByPath(const PathHandle& handle) const {
+    if (!handle.isParameterPath()) {
+        return getValueByPath(handle.getPath());
     }
     
-    if (components.size() >= 2) {
-        // Delete parameter
-        auto param_it = section_it->parameters.find(components[1]);
-        if (param_it != section_it->parameters.end()) {
-            section_it->parameters.erase(param_it);
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    size_t sectionIndex = 0;
+    const ConfigParameter* param = resolvePath_unlocked(handle, sectionIndex);
+    return param ? param->value : "";
+}
+
+bool OopParser::setValueByPath(const PathHandle& handle, const std::string& value) {
+    if (handle.isParameterPath()) {
+        std::lock_guard<std::mutex> lock(sectionsMutex_);
+        size_t sectionIndex = 0;
+        ConfigParameter* param = resolvePath_unlocked(handle, sectionIndex);
+        
+        // Overwrite in place when the layout does not change
+        if (param && sections_[sectionIndex].use_count() == 1) {
+            param->value = value;
+            validationDirty_.insert(sections_[sectionIndex].get());
+            std::string type = detectType(value);
+            if (type != param->type) {
+                param->type = std::move(type);
+                typeIndexDirty_.insert(sections_[sectionIndex].get());
+            }
             return true;
         }
     }
     
-    lastError_ = "Path not found: " + path;
-    return false;
+    return setValueByPath(handle.getPath(), value);
 }
 
-std::vector<std::string> OopParser::getAllPaths() const {
-    std::vector<std::string> paths;
+bool OopParser::getDoubleByPath(const PathHandle& handle, double& value) const {
+    if (!handle.isParameterPath()) {
+        return false;
+    }
     std::lock_guard<std::mutex> lock(sectionsMutex_);
-    
-    for (const auto& section : sections_) {
-        // Add section path
-        paths.push_back("/" + escapePathToken(section.name));
-        
-        // Add parameter paths
-        for (const auto& [key, param] : section.parameters) {
-            std::string param_path = "/" + escapePathToken(section.name) + 
-                                     "/" + escapePathToken(key);
-            paths.push_back(param_path);
-        }
+    size_t sectionIndex = 0;
+    const ConfigParameter* param = resolvePath_unlocked(handle, sectionIndex);
+    return param && parseDoubleValue(param->value, value);
+}
+
+bool OopParser::getIntByPath(const PathHandle& handle, int& value) const {
+    if (!handle.isParameterPath()) {
+        return false;
     }
-    
-    return paths;
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    size_t sectionIndex = 0;
+    const ConfigParameter* param = resolvePath_unlocked(handle, sectionIndex);
+    return param && parseIntValue(param->value, value);
+}
+
+bool OopParser::getBoolByPath(const PathHandle& handle, bool& value) const {
+    if (!handle.isParameterPath()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(sectionsMutex_);
+    size_t sectionIndex = 0;
+    const ConfigParameter* param = resolvePath_unlocked(handle, sectionIndex);
+    return param && parseBoolValue(param->value, value);
 }
 
 // ============ Utility Functions ============
@@ -2743,6 +6363,68 @@ BatchStats BatchProcessor::validateAll(const std::vector<std::string>& filepaths
     return stats;
 }
 
+BatchStats BatchProcessor::validateAllWithSchema(const std::vector<std::string>& filepaths,
+                                                 const ConfigSchema& schema,
+                                                 size_t threads) {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    auto start = std::chrono::steady_clock::now();
+    
+    BatchStats stats;
+    stats.total_files = filepaths.size();
+    stats.file_results.resize(filepaths.size());
+    
+    const CompiledSchema compiled(schema);
+    
+    // Workers claim files from a shared counter; each writes only its own slots
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (size_t i = next++; i < filepaths.size(); i = next++) {
+            auto& result = stats.file_results[i];
+            result.filepath = filepaths[i];
+            
+            std::string ext = std::filesystem::path(filepaths[i]).extension().string();
+            if (!ext.empty()) ext.erase(0, 1);
+            std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+            bool known = ext == "json" || ext == "xml" || ext == "csv" ||
+                         ext == "yaml" || ext == "yml" || ext == "toml";
+            
+            OopParser parser;
+            result.loaded = loadConfigByFormat(parser, filepaths[i], known ? ext : "oop");
+            if (result.loaded) {
+                parser.validateFull(compiled, result.issues);
+            }
+        }
+    };
+    
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = std::min(threads, filepaths.size());
+    if (threads <= 1) {
+        worker();
+    } else {
+        WorkerPool::instance().run(threads, [&worker](size_t) { worker(); });
+    }
+    
+    for (const auto& result : stats.file_results) {
+        if (result.loaded && result.issues.empty()) {
+            stats.successful_operations++;
+            continue;
+        }
+        stats.failed_operations++;
+        stats.failed_files.push_back(result.filepath);
+        stats.error_messages.push_back(result.loaded
+            ? "Schema validation failed (" + std::to_string(result.issues.size()) + " issues): " + result.filepath
+            : "Failed to load: " + result.filepath);
+    }
+    
+    stats.elapsed_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    stats.files_per_second = stats.elapsed_seconds > 0 ? stats.total_files / stats.elapsed_seconds : 0.0;
+    
+    lastStats_ = stats;
+    return stats;
+}
+
 BatchStats BatchProcessor::convertAll(const std::vector<std::string>& sourceFiles,
                                      const std::string& sourceFormat,
                                      const std::string& targetFormat,
@@ -2874,6 +6556,9 @@ void BatchProcessor::clearStats() {
     lastStats_.failed_operations = 0;
     lastStats_.failed_files.clear();
     lastStats_.error_messages.clear();
+    lastStats_.file_results.clear();
+    lastStats_.elapsed_seconds = 0.0;
+    lastStats_.files_per_second = 0.0;
 }
 
 bool BatchProcessor::loadConfigByFormat(OopParser& config, const std::string& filepath,
@@ -3041,7 +6726,7 @@ bool OopParser::saveToStream(std::ostream& output) const {
     }
     
     try {
-        auto sections = getAllSections();
+        SectionsView sections = viewSections();
         
         for (size_t i = 0; i < sections.size(); ++i) {
             const auto& section = sections[i];
@@ -3143,7 +6828,15 @@ bool OopParser::saveToPipe(int fd) const {
 // ===== VersionedOopParser Implementation =====
 
 VersionedOopParser::VersionedOopParser()
-    : OopParser(), currentVersion_(0), versioningEnabled_(false) {}
+    : OopParser(), currentVersion_(0), versioningEnabled_(false),
+      storageMode_(VersionStorageMode::FULL_SNAPSHOT), keyframeInterval_(16),
+      deltasSinceKeyframe_(0), maxVersions_(0), maxHistoryBytes_(0), historyBytes_(0),
+      journalFile_(nullptr), journalBytes_(0), recordsSinceCheckpoint_(0), nextCompactionAt_(0),
+      compactionRunning_(false), compactionResult_(true) {}
+
+VersionedOopParser::~VersionedOopParser() {
+    detachJournal();
+}
 
 std::string VersionedOopParser::generateTimestamp() const {
     auto now = std::chrono::system_clock::now();
@@ -3157,224 +6850,1026 @@ std::string VersionedOopParser::generateTimestamp() const {
     return oss.str();
 }
 
-bool VersionedOopParser::enableVersioning(const std::string& initialDescription) {
+// Internal helper - assumes lock is already held
+bool VersionedOopParser::appendVersion_unlocked(const std::string& description, bool reset) {
+    size_t newVersion = reset || versions_.empty() ? 1 : versions_.back().version + 1;
+    auto state = std::make_shared<OopParser>();
+    state->copyFrom(*this);  // Copy current state into the snapshot
+    
+    // Changes relative to the previous version; cheap since unchanged
+    // sections are shared with it
+    VersionEntry entry(newVersion, generateTimestamp(), description);
+    if (tipState_ && !reset) {
+        entry.delta = tipState_->diff_impl(*state, false);
+    }
+    
+    // Write-ahead: history changes only once the journal has the record
+    if (journalFile_ && !journalVersion_unlocked(entry, *state, reset)) {
+        return false;
+    }
+    
+    if (reset) {
+        versions_.clear();
+        tipState_.reset();
+        historyBytes_ = 0;
+    }
+    storeVersion_unlocked(std::move(entry), state, reset);
+    evictHistory_unlocked();
+    return true;
+}
+
+// Internal helper - assumes lock is already held
+void VersionedOopParser::storeVersion_unlocked(VersionEntry entry, std::shared_ptr<OopParser> state,
+                                               bool forceKeyframe) {
+    bool keyframe = forceKeyframe || !tipState_ ||
+                    storageMode_ == VersionStorageMode::FULL_SNAPSHOT ||
+                    deltasSinceKeyframe_ + 1 >= keyframeInterval_;
+    
+    entry.snapshot = state;
+    
+    if (keyframe) {
+        deltasSinceKeyframe_ = 0;
+    } else {
+        entry.snapshot.reset();
+        entry.is_keyframe = false;
+        deltasSinceKeyframe_++;
+    }
+    
+    entry.size_bytes = entryBytes_unlocked(entry, tipState_.get());
+    historyBytes_ += entry.size_bytes;
+    currentVersion_ = entry.version;
+    versions_.push_back(std::move(entry));
+    tipState_ = state;
+}
+
+// Internal helper - assumes lock is already held
+size_t VersionedOopParser::findVersionIndex_unlocked(size_t version) const {
+    // Retained versions are consecutive, so the index follows from the oldest one
+    if (versions_.empty() || version < versions_.front().version) {
+        return versions_.size();
+    }
+    size_t index = version - versions_.front().version;
+    return index < versions_.size() ? index : versions_.size();
+}
+
+// Internal helper - assumes lock is already held
+std::shared_ptr<OopParser> VersionedOopParser::materialize_unlocked(size_t index) const {
+    if (versions_[index].is_keyframe) {
+        return versions_[index].snapshot;
+    }
+    if (index == versions_.size() - 1 && tipState_) {
+        return tipState_;
+    }
+    
+    // Walk back to the nearest keyframe, then replay deltas forward
+    size_t keyframe = index;
+    while (keyframe > 0 && !versions_[keyframe].is_keyframe) {
+        keyframe--;
+    }
+    
+    auto state = std::make_shared<OopParser>();
+    state->copyFrom(*versions_[keyframe].snapshot);
+    for (size_t i = keyframe + 1; i <= index; ++i) {
+        state->applyDiff(versions_[i].delta);
+    }
+    return state;
+}
+
+// Internal helper - assumes lock is already held
+size_t VersionedOopParser::entryBytes_unlocked(const VersionEntry& entry, const OopParser* previous) const {
+    size_t bytes = sizeof(VersionEntry) + stringHeapBytes(entry.timestamp) +
+                   stringHeapBytes(entry.description) + deltaBytes(entry.delta);
+    if (!entry.snapshot) {
+        return bytes;
+    }
+    
+    std::set<const ConfigSectionData*> shared;
+    if (previous) {
+        std::lock_guard<std::mutex> previous_lock(previous->sectionsMutex_);
+        for (const auto& section : previous->sections_) {
+            shared.insert(section.get());
+        }
+    }
+    
+    std::lock_guard<std::mutex> snapshot_lock(entry.snapshot->sectionsMutex_);
+    bytes += sizeof(OopParser) +
+             entry.snapshot->sections_.capacity() * sizeof(std::shared_ptr<ConfigSectionData>);
+    for (const auto& section : entry.snapshot->sections_) {
+        if (shared.count(section.get()) == 0) {
+            bytes += sectionBytes(*section);
+        }
+    }
+    return bytes;
+}
+
+// Internal helper - assumes lock is already held
+void VersionedOopParser::evictHistory_unlocked() {
+    while (versions_.size() > 1 &&
+           ((maxVersions_ > 0 && versions_.size() > maxVersions_) ||
+            (maxHistoryBytes_ > 0 && historyBytes_ > maxHistoryBytes_))) {
+        VersionEntry& next = versions_[1];
+        if (!next.is_keyframe) {
+            // The oldest retained entry must hold a full snapshot
+            next.snapshot = materialize_unlocked(1);
+            next.delta.clear();
+            next.delta.shrink_to_fit();
+            next.is_keyframe = true;
+        }
+        
+        // Sections shared with the evicted entry are now charged to its successor
+        historyBytes_ -= versions_.front().size_bytes + next.size_bytes;
+        next.size_bytes = entryBytes_unlocked(next, nullptr);
+        historyBytes_ += next.size_bytes;
+        versions_.pop_front();
+    }
+}
+
+bool VersionedOopParser::enableVersioning(const std::string& initialDescription) {
+    std::lock_guard<std::mutex> lock(version_mutex_);
+    
+    if (versioningEnabled_) {
+        return true;  // Already enabled
+    }
+    
+    // Create initial snapshot
+    if (!appendVersion_unlocked(initialDescription, true)) {
+        return false;
+    }
+    versioningEnabled_ = true;
+    
+    return true;
+}
+
+bool VersionedOopParser::disableVersioning() {
+    std::lock_guard<std::mutex> lock(version_mutex_);
+    
+    if (!versioningEnabled_) {
+        return true;  // Already disabled
+    }
+    
+    versioningEnabled_ = false;
+    return true;
+}
+
+bool VersionedOopParser::isVersioningEnabled() const {
+    std::lock_guard<std::mutex> lock(version_mutex_);
+    return versioningEnabled_;
+}
+
+size_t VersionedOopParser::getCurrentVersion() const {
+    std::lock_guard<std::mutex> lock(version_mutex_);
+    return currentVersion_;
+}
+
+size_t VersionedOopParser::getVersionCount() const {
+    std::lock_guard<std::mutex> lock(version_mutex_);
+    return versions_.size();
+}
+
+std::vector<VersionEntry> VersionedOopParser::getHistory() const {
+    std::lock_guard<std::mutex> lock(version_mutex_);
+    // Returns a copy - safe outside the lock
+    return std::vector<VersionEntry>(versions_.begin(), versions_.end());
+}
+
+void VersionedOopParser::forEachVersion(const std::function<void(const VersionEntry&)>& visitor) const {
+    std::lock_guard<std::mutex> lock(version_mutex_);
+    for (const auto& entry : versions_) {
+        visitor(entry);
+    }
+}
+
+const VersionEntry* VersionedOopParser::getVersion(size_t version) const {
+    std::lock_guard<std::mutex> lock(version_mutex_);
+    
+    size_t index = findVersionIndex_unlocked(version);
+    return index < versions_.size() ? &versions_[index] : nullptr;
+}
+
+size_t VersionedOopParser::getOldestVersion() const {
+    std::lock_guard<std::mutex> lock(version_mutex_);
+    return versions_.empty() ? 0 : versions_.front().version;
+}
+
+bool VersionedOopParser::createVersion(const std::string& description) {
+    std::lock_guard<std::mutex> lock(version_mutex_);
+    
+    if (!versioningEnabled_) {
+        return false;
+    }
+    
+    return appendVersion_unlocked(description, false);
+}
+
+static nlohmann::json journalRollbackRecord(size_t version);
+
+// Internal helper - assumes lock is already held
+bool VersionedOopParser::rollback_unlocked(size_t version) {
+    if (!versioningEnabled_) {
+        return false;
+    }
+    
+    // Find target version
+    size_t index = findVersionIndex_unlocked(version);
+    if (index == versions_.size()) {
+        std::cerr << "Version " << version << " not found in history" << std::endl;
+        return false;
+    }
+    
+    // Journal first so recovery restores the rolled-back configuration
+    if (journalFile_ && !writeJournalRecord_unlocked(journalRollbackRecord(version), false)) {
+        return false;
+    }
+    
+    // Restore from snapshot (rebuilt from deltas if needed) using copyFrom
+    this->copyFrom(*materialize_unlocked(index));
+    
+    // Update current version
+    currentVersion_ = version;
+    
+    return true;
+}
+
+bool VersionedOopParser::rollback(size_t version) {
+    std::lock_guard<std::mutex> lock(version_mutex_);
+    return rollback_unlocked(version);
+}
+
+bool VersionedOopParser::rollbackPrevious() {
+    std::lock_guard<std::mutex> lock(version_mutex_);
+    
+    if (!versioningEnabled_ || currentVersion_ <= 1) {
+        return false;
+    }
+    
+    return rollback_unlocked(currentVersion_ - 1);
+}
+
+bool VersionedOopParser::clearHistory() {
+    std::lock_guard<std::mutex> lock(version_mutex_);
+    
+    if (!versioningEnabled_) {
+        return false;
+    }
+    
+    // Keep only current version as version 1
+    return appendVersion_unlocked("Reset point", true);
+}
+
+std::string VersionedOopParser::getVersionDescription(size_t version) const {
+    std::lock_guard<std::mutex> lock(version_mutex_);
+    
+    size_t index = findVersionIndex_unlocked(version);
+    return index < versions_.size() ? versions_[index].description : "";
+}
+
+std::string VersionedOopParser::getVersionTimestamp(size_t version) const {
+    std::lock_guard<std::mutex> lock(version_mutex_);
+    
+    size_t index = findVersionIndex_unlocked(version);
+    return index < versions_.size() ? versions_[index].timestamp : "";
+}
+
+// Net effect of a run of changes on one parameter
+struct ComposedChange {
+    DiffEntry entry;        ///< First "before" side, latest "after" side
+    bool existedBefore;     ///< Parameter existed before the first change
+};
+
+// Fold a forward change set into the net changes collected so far
+static void composeChanges(std::map<std::pair<std::string, std::string>, ComposedChange>& net,
+                           const std::vector<DiffEntry>& changes) {
+    for (const auto& change : changes) {
+        if (change.type == DiffEntry::UNCHANGED) {
+            continue;
+        }
+        auto [it, inserted] = net.try_emplace({change.section, change.key},
+                                              ComposedChange{change, change.type != DiffEntry::ADDED});
+        if (!inserted) {
+            it->second.entry.newValue = change.newValue;
+            it->second.entry.newType = change.newType;
+            it->second.entry.type = change.type;
+        }
+    }
+}
+
+// Turn "a -> b" into "b -> a"
+static DiffEntry invertChange(DiffEntry change) {
+    std::swap(change.oldValue, change.newValue);
+    std::swap(change.oldType, change.newType);
+    if (change.type == DiffEntry::ADDED) {
+        change.type = DiffEntry::REMOVED;
+    } else if (change.type == DiffEntry::REMOVED) {
+        change.type = DiffEntry::ADDED;
+    }
+    return change;
+}
+
+std::vector<DiffEntry> VersionedOopParser::getVersionDiff(size_t fromVersion, size_t toVersion,
+                                                          bool onlyChanges) const {
     std::lock_guard<std::mutex> lock(version_mutex_);
     
-    if (versioningEnabled_) {
-        return true;  // Already enabled
+    size_t from = findVersionIndex_unlocked(fromVersion);
+    size_t to = findVersionIndex_unlocked(toVersion);
+    
+    if (from == versions_.size() || to == versions_.size()) {
+        return {};  // Empty diff if versions not found
     }
     
-    // Create initial snapshot
-    VersionEntry initial(1, generateTimestamp(), initialDescription);
-    initial.snapshot->copyFrom(*this);  // Copy current state into unique_ptr
+    if (onlyChanges) {
+        size_t lo = std::min(from, to);
+        size_t hi = std::max(from, to);
+        size_t pending = 0;
+        for (size_t i = lo + 1; i <= hi; ++i) {
+            pending += versions_[i].delta.size();
+        }
+        
+        if (pending <= tipState_->getParameterCount()) {
+            std::map<std::pair<std::string, std::string>, ComposedChange> net;
+            for (size_t i = lo + 1; i <= hi; ++i) {
+                composeChanges(net, versions_[i].delta);
+            }
+            
+            std::vector<DiffEntry> result;
+            for (auto& [key, composed] : net) {
+                DiffEntry& change = composed.entry;
+                bool existsAfter = change.type != DiffEntry::REMOVED;
+                if (composed.existedBefore && existsAfter) {
+                    if (change.oldValue == change.newValue) {
+                        continue;
+                    }
+                    change.type = DiffEntry::MODIFIED;
+                } else if (existsAfter) {
+                    change.type = DiffEntry::ADDED;
+                } else if (composed.existedBefore) {
+                    change.type = DiffEntry::REMOVED;
+                    change.newValue.clear();
+                    change.newType.clear();
+                } else {
+                    continue;  // Added and removed again
+                }
+                // Composed changes run lo -> hi; the result runs to -> from
+                result.push_back(to < from ? change : invertChange(change));
+            }
+            return result;
+        }
+        return materialize_unlocked(to)->diff_impl(*materialize_unlocked(from), false);
+    }
     
-    versions_.clear();
-    versions_.push_back(std::move(initial));
-    currentVersion_ = 1;
-    versioningEnabled_ = true;
+    // Use OopParser's diff method on the snapshots
+    std::vector<DiffEntry> result;
+    try {
+        // Compare using the snapshots
+        result = materialize_unlocked(to)->diff(*materialize_unlocked(from));
+    } catch (const std::exception& e) {
+        std::cerr << "Error comparing versions: " << e.what() << std::endl;
+    }
     
-    return true;
+    return result;
 }
 
-bool VersionedOopParser::disableVersioning() {
+nlohmann::json VersionedOopParser::getHistoryAsJson() const {
     std::lock_guard<std::mutex> lock(version_mutex_);
     
-    if (!versioningEnabled_) {
-        return true;  // Already disabled
+    nlohmann::json history = nlohmann::json::array();
+    
+    // Configurations are rebuilt in one forward pass, not per entry
+    for (const auto& [entry, snapshot] : captureHistory_unlocked()) {
+        nlohmann::json versionJson = nlohmann::json::object();
+        versionJson["version"] = entry.version;
+        versionJson["timestamp"] = entry.timestamp;
+        versionJson["description"] = entry.description;
+        versionJson["keyframe"] = entry.is_keyframe;
+        versionJson["sections"] = snapshot->getSectionCount();
+        versionJson["parameters"] = snapshot->getParameterCount();
+        history.push_back(versionJson);
     }
     
-    versioningEnabled_ = false;
+    return history;
+}
+
+bool VersionedOopParser::setStorageMode(VersionStorageMode mode, size_t keyframeInterval) {
+    if (keyframeInterval == 0) {
+        return false;
+    }
+    
+    std::lock_guard<std::mutex> lock(version_mutex_);
+    storageMode_ = mode;
+    keyframeInterval_ = keyframeInterval;
     return true;
 }
 
-bool VersionedOopParser::isVersioningEnabled() const {
+VersionStorageMode VersionedOopParser::getStorageMode() const {
     std::lock_guard<std::mutex> lock(version_mutex_);
-    return versioningEnabled_;
+    return storageMode_;
 }
 
-size_t VersionedOopParser::getCurrentVersion() const {
+std::shared_ptr<const OopParser> VersionedOopParser::getVersionSnapshot(size_t version) const {
     std::lock_guard<std::mutex> lock(version_mutex_);
-    return currentVersion_;
+    
+    size_t index = findVersionIndex_unlocked(version);
+    if (index == versions_.size()) {
+        return nullptr;
+    }
+    return materialize_unlocked(index);
 }
 
-size_t VersionedOopParser::getVersionCount() const {
+void VersionedOopParser::setHistoryLimits(size_t maxVersions, size_t maxBytes) {
     std::lock_guard<std::mutex> lock(version_mutex_);
-    return versions_.size();
+    maxVersions_ = maxVersions;
+    maxHistoryBytes_ = maxBytes;
+    evictHistory_unlocked();
 }
 
-std::vector<VersionEntry> VersionedOopParser::getHistory() const {
+size_t VersionedOopParser::getMaxVersions() const {
     std::lock_guard<std::mutex> lock(version_mutex_);
-    return versions_;  // Returns a copy - safe outside the lock
+    return maxVersions_;
 }
 
-const VersionEntry* VersionedOopParser::getVersion(size_t version) const {
+size_t VersionedOopParser::getMaxHistoryBytes() const {
+    std::lock_guard<std::mutex> lock(version_mutex_);
+    return maxHistoryBytes_;
+}
+
+size_t VersionedOopParser::getHistoryMemoryUsage() const {
     std::lock_guard<std::mutex> lock(version_mutex_);
     
+    // Snapshots share unchanged sections, so count each section object once
+    std::set<const ConfigSectionData*> counted;
+    auto snapshotBytes = [&counted](const OopParser& snapshot) {
+        std::lock_guard<std::mutex> snapshot_lock(snapshot.sectionsMutex_);
+        size_t total = sizeof(OopParser) +
+                       snapshot.sections_.capacity() * sizeof(std::shared_ptr<ConfigSectionData>);
+        for (const auto& section : snapshot.sections_) {
+            if (counted.insert(section.get()).second) {
+                total += sectionBytes(*section);
+            }
+        }
+        return total;
+    };
+    
+    size_t bytes = 0;
     for (const auto& entry : versions_) {
-        if (entry.version == version) {
-            return &entry;
+        bytes += sizeof(VersionEntry) + stringHeapBytes(entry.timestamp) +
+                 stringHeapBytes(entry.description) + deltaBytes(entry.delta);
+        if (entry.snapshot) {
+            bytes += snapshotBytes(*entry.snapshot);
         }
     }
     
-    return nullptr;
+    // The latest configuration is cached separately when it is a delta entry
+    if (tipState_ && (versions_.empty() || versions_.back().snapshot != tipState_)) {
+        bytes += snapshotBytes(*tipState_);
+    }
+    
+    return bytes;
 }
 
-bool VersionedOopParser::createVersion(const std::string& description) {
-    std::lock_guard<std::mutex> lock(version_mutex_);
-    
-    if (!versioningEnabled_) {
-        return false;
+// ===== Version Journal Implementation =====
+//
+// The journal holds one JSON record per line:
+//   {"op":"checkpoint","version":N,"timestamp":...,"description":...,
+//    "sections":[{"name":...,"parameters":[[key,value,type],...]}]}
+//   {"op":"delta","version":N,"timestamp":...,"description":...,
+//    "changes":[["A"|"M"|"R",section,key,value,type],...]}
+//   {"op":"rollback","version":N}
+// A checkpoint whose version does not follow the previous record starts a
+// new history (enableVersioning/clearHistory).
+
+// Open the journal for appending (optionally emptied first), unbuffered so
+// a failed write leaves nothing behind to be flushed later
+static FILE* openJournalFile(const std::string& path, bool truncate) {
+    if (truncate) {
+        FILE* created = std::fopen(path.c_str(), "wb");
+        if (!created) {
+            return nullptr;
+        }
+        std::fclose(created);
+    }
+    FILE* file = std::fopen(path.c_str(), "ab");
+    if (file) {
+        std::setvbuf(file, nullptr, _IONBF, 0);
+    }
+    return file;
+}
+
+static bool syncFile(FILE* file) {
+#ifdef _WIN32
+    return _commit(_fileno(file)) == 0;
+#else
+    return fsync(fileno(file)) == 0;
+#endif
+}
+
+static nlohmann::json journalRecordHeader(const char* op, const VersionEntry& entry) {
+    nlohmann::json record = nlohmann::json::object();
+    record["op"] = op;
+    record["version"] = entry.version;
+    record["timestamp"] = entry.timestamp;
+    record["description"] = entry.description;
+    return record;
+}
+
+static nlohmann::json journalRollbackRecord(size_t version) {
+    nlohmann::json record = nlohmann::json::object();
+    record["op"] = "rollback";
+    record["version"] = version;
+    return record;
+}
+
+static nlohmann::json journalCheckpointRecord(const VersionEntry& entry, const OopParser& state) {
+    nlohmann::json record = journalRecordHeader("checkpoint", entry);
+    nlohmann::json sections = nlohmann::json::array();
+    state.forEachSection([&sections](const ConfigSectionData& section) {
+        nlohmann::json params = nlohmann::json::array();
+        for (const auto& [key, param] : section.parameters) {
+            params.push_back(nlohmann::json::array({key, param.value, param.type}));
+        }
+        sections.push_back({{"name", section.name}, {"parameters", params}});
+    });
+    record["sections"] = sections;
+    return record;
+}
+
+static nlohmann::json journalDeltaRecord(const VersionEntry& entry, const std::vector<DiffEntry>& changes) {
+    nlohmann::json record = journalRecordHeader("delta", entry);
+    nlohmann::json list = nlohmann::json::array();
+    for (const auto& change : changes) {
+        if (change.type == DiffEntry::UNCHANGED) {
+            continue;
+        }
+        const char* op = change.type == DiffEntry::ADDED ? "A" :
+                         change.type == DiffEntry::REMOVED ? "R" : "M";
+        list.push_back(nlohmann::json::array({op, change.section, change.key,
+                                              change.newValue, change.newType}));
+    }
+    record["changes"] = list;
+    return record;
+}
+
+// Turn a journal record into diff entries (a checkpoint becomes a list of additions)
+static bool decodeJournalChanges(const nlohmann::json& record, std::vector<DiffEntry>& changes) {
+    if (record.contains("sections")) {
+        for (const auto& section : record.at("sections")) {
+            DiffEntry added;
+            added.type = DiffEntry::ADDED;
+            added.section = section.at("name").get<std::string>();
+            changes.push_back(added);
+            for (const auto& param : section.at("parameters")) {
+                DiffEntry entry;
+                entry.type = DiffEntry::ADDED;
+                entry.section = section.at("name").get<std::string>();
+                entry.key = param.at(0).get<std::string>();
+                entry.newValue = param.at(1).get<std::string>();
+                entry.newType = param.at(2).get<std::string>();
+                changes.push_back(entry);
+            }
+        }
+        return true;
     }
     
-    // Create new version
-    size_t newVersion = currentVersion_ + 1;
-    VersionEntry entry(newVersion, generateTimestamp(), description);
-    entry.snapshot->copyFrom(*this);  // Copy current state into unique_ptr
-    
-    versions_.push_back(std::move(entry));
-    currentVersion_ = newVersion;
-    
+    for (const auto& change : record.at("changes")) {
+        DiffEntry entry;
+        std::string op = change.at(0).get<std::string>();
+        if (op == "A") {
+            entry.type = DiffEntry::ADDED;
+        } else if (op == "M") {
+            entry.type = DiffEntry::MODIFIED;
+        } else if (op == "R") {
+            entry.type = DiffEntry::REMOVED;
+        } else {
+            return false;
+        }
+        entry.section = change.at(1).get<std::string>();
+        entry.key = change.at(2).get<std::string>();
+        entry.newValue = change.at(3).get<std::string>();
+        entry.newType = change.at(4).get<std::string>();
+        changes.push_back(entry);
+    }
     return true;
 }
 
-// Internal helper - assumes lock is already held
-bool VersionedOopParser::rollback_unlocked(size_t version) {
-    if (!versioningEnabled_) {
+bool VersionedOopParser::attachJournal(const std::string& path, const JournalOptions& options) {
+    if (options.checkpoint_interval == 0) {
         return false;
     }
+    detachJournal();
     
-    // Find target version
-    const VersionEntry* target = nullptr;
-    for (const auto& entry : versions_) {
-        if (entry.version == version) {
-            target = &entry;
-            break;
-        }
+    size_t fileBytes = 0;
+    std::ifstream in(path, std::ios::binary);
+    if (in) {
+        in.seekg(0, std::ios::end);
+        fileBytes = static_cast<size_t>(in.tellg());
+        in.seekg(0, std::ios::beg);
     }
     
-    if (!target) {
-        std::cerr << "Version " << version << " not found in history" << std::endl;
+    // Replay into a scratch parser so a failed recovery leaves this one untouched
+    VersionedOopParser recovered;
+    size_t validBytes = 0;
+    if (fileBytes > 0) {
+        std::lock_guard<std::mutex> lock(version_mutex_);
+        recovered.storageMode_ = storageMode_;
+        recovered.keyframeInterval_ = keyframeInterval_;
+        recovered.maxVersions_ = maxVersions_;
+        recovered.maxHistoryBytes_ = maxHistoryBytes_;
+    }
+    if (fileBytes > 0 && recovered.replayJournal_unlocked(in, validBytes) == 0) {
+        std::cerr << "No readable records in version journal: " << path << std::endl;
         return false;
     }
+    in.close();
     
-    // Restore from snapshot using copyFrom
-    this->copyFrom(*target->snapshot);
+    // Only a torn final record is cut off; unreadable records before it are skipped
+    if (validBytes < fileBytes) {
+        std::cerr << "Discarding " << (fileBytes - validBytes)
+                  << " bytes of torn final record in version journal: " << path << std::endl;
+        std::error_code ec;
+        std::filesystem::resize_file(path, validBytes, ec);
+        if (ec) {
+            std::cerr << "Failed to truncate version journal: " << ec.message() << std::endl;
+            return false;
+        }
+    }
     
-    // Update current version
-    currentVersion_ = version;
+    std::lock_guard<std::mutex> lock(version_mutex_);
+    journalOptions_ = options;
+    
+    if (fileBytes > 0) {
+        // Recovered history replaces the in-memory one
+        versions_ = std::move(recovered.versions_);
+        tipState_ = recovered.tipState_;
+        historyBytes_ = recovered.historyBytes_;
+        deltasSinceKeyframe_ = recovered.deltasSinceKeyframe_;
+        recordsSinceCheckpoint_ = recovered.recordsSinceCheckpoint_;
+        versioningEnabled_ = true;
+        
+        // The last rollback, if no version followed it, selects the configuration
+        size_t index = findVersionIndex_unlocked(recovered.currentVersion_);
+        if (index == versions_.size()) {
+            index = versions_.size() - 1;
+        }
+        currentVersion_ = versions_[index].version;
+        this->copyFrom(*materialize_unlocked(index));
+        
+        journalFile_ = openJournalFile(path, false);
+        journalBytes_ = validBytes;
+    } else {
+        journalFile_ = openJournalFile(path, true);
+        journalBytes_ = 0;
+        if (journalFile_ && !versions_.empty()) {
+            size_t bytes = 0;
+            if (!writeJournalHistory(journalFile_, captureHistory_unlocked(), currentVersion_,
+                                     journalOptions_, bytes) ||
+                std::fflush(journalFile_) != 0 || !syncFile(journalFile_)) {
+                std::fclose(journalFile_);
+                journalFile_ = nullptr;
+            }
+            journalBytes_ = bytes;
+        }
+        // Next record after the initial content is a checkpoint
+        recordsSinceCheckpoint_ = options.checkpoint_interval;
+    }
     
+    if (!journalFile_) {
+        std::cerr << "Failed to open version journal: " << path << std::endl;
+        return false;
+    }
+    journalPath_ = path;
+    nextCompactionAt_ = options.compact_threshold_bytes;
     return true;
 }
 
-bool VersionedOopParser::rollback(size_t version) {
+void VersionedOopParser::detachJournal() {
+    waitForJournalCompaction();
+    {
+        std::lock_guard<std::mutex> lock(version_mutex_);
+        if (journalFile_) {
+            std::fclose(journalFile_);
+            journalFile_ = nullptr;
+        }
+        journalPath_.clear();
+        journalBytes_ = 0;
+    }
+    // A compaction started before the file was closed gives up on its own
+    waitForJournalCompaction();
+}
+
+bool VersionedOopParser::isJournalAttached() const {
     std::lock_guard<std::mutex> lock(version_mutex_);
-    return rollback_unlocked(version);;
+    return journalFile_ != nullptr;
 }
 
-bool VersionedOopParser::rollbackPrevious() {
+size_t VersionedOopParser::getJournalSize() const {
     std::lock_guard<std::mutex> lock(version_mutex_);
-    
-    if (!versioningEnabled_ || currentVersion_ <= 1) {
-        return false;
+    return journalBytes_;
+}
+
+bool VersionedOopParser::compactJournal() {
+    waitForJournalCompaction();
+    {
+        std::lock_guard<std::mutex> lock(version_mutex_);
+        if (!startCompaction_unlocked()) {
+            return false;
+        }
     }
-    
-    return rollback_unlocked(currentVersion_ - 1);
+    return waitForJournalCompaction();
 }
 
-bool VersionedOopParser::clearHistory() {
+bool VersionedOopParser::startJournalCompaction() {
     std::lock_guard<std::mutex> lock(version_mutex_);
-    
-    if (!versioningEnabled_) {
+    return startCompaction_unlocked();
+}
+
+bool VersionedOopParser::waitForJournalCompaction() {
+    std::thread worker;
+    {
+        std::lock_guard<std::mutex> lock(version_mutex_);
+        worker = std::move(compactionThread_);
+    }
+    if (worker.joinable()) {
+        worker.join();
+    }
+    return compactionResult_;
+}
+
+// Internal helper - assumes lock is already held
+bool VersionedOopParser::startCompaction_unlocked() {
+    if (!journalFile_ || compactionRunning_) {
         return false;
     }
+    if (compactionThread_.joinable()) {
+        compactionThread_.join();  // Previous worker has already finished
+    }
     
-    // Keep only current version as version 1
-    VersionEntry current(1, generateTimestamp(), "Reset point");
-    current.snapshot->copyFrom(*this);
-    
-    versions_.clear();
-    versions_.push_back(std::move(current));
-    currentVersion_ = 1;
-    
+    compactionRunning_ = true;
+    compactionThread_ = std::thread([this]() {
+        compactionResult_ = runCompaction();
+        compactionRunning_ = false;
+    });
     return true;
 }
 
-std::string VersionedOopParser::getVersionDescription(size_t version) const {
-    std::lock_guard<std::mutex> lock(version_mutex_);
-    
-    for (const auto& entry : versions_) {
-        if (entry.version == version) {
-            return entry.description;
+bool VersionedOopParser::runCompaction() {
+    std::vector<std::pair<VersionEntry, std::shared_ptr<const OopParser>>> history;
+    size_t current = 0;
+    size_t offset = 0;
+    std::string path;
+    JournalOptions options;
+    {
+        std::lock_guard<std::mutex> lock(version_mutex_);
+        if (!journalFile_) {
+            return false;
         }
+        history = captureHistory_unlocked();
+        current = currentVersion_;
+        offset = journalBytes_;
+        path = journalPath_;
+        options = journalOptions_;
+    }
+    
+    // Write the compacted history without blocking new versions
+    std::string tempPath = path + ".compact";
+    FILE* out = std::fopen(tempPath.c_str(), "wb");
+    if (!out) {
+        std::cerr << "Failed to create compacted journal: " << tempPath << std::endl;
+        return false;
     }
+    size_t bytes = 0;
+    bool ok = writeJournalHistory(out, history, current, options, bytes);
     
-    return "";
-}
-
-std::string VersionedOopParser::getVersionTimestamp(size_t version) const {
     std::lock_guard<std::mutex> lock(version_mutex_);
-    
-    for (const auto& entry : versions_) {
-        if (entry.version == version) {
-            return entry.timestamp;
+    ok = ok && journalFile_ != nullptr && journalPath_ == path;
+    
+    // Carry over records appended while the compacted copy was written
+    if (ok) {
+        FILE* in = std::fopen(path.c_str(), "rb");
+        ok = in != nullptr && std::fseek(in, static_cast<long>(offset), SEEK_SET) == 0;
+        char buffer[65536];
+        size_t n = 0;
+        while (ok && (n = std::fread(buffer, 1, sizeof(buffer), in)) > 0) {
+            ok = std::fwrite(buffer, 1, n, out) == n;
+            bytes += n;
+        }
+        if (in) {
+            std::fclose(in);
         }
     }
+    ok = ok && std::fflush(out) == 0 && syncFile(out);
+    ok = (std::fclose(out) == 0) && ok;
     
-    return "";
+    if (!ok) {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    
+    std::fclose(journalFile_);
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0) {
+        std::cerr << "Failed to replace version journal: " << path << std::endl;
+        std::remove(tempPath.c_str());
+        journalFile_ = openJournalFile(path, false);
+        return false;
+    }
+    journalFile_ = openJournalFile(path, false);
+    journalBytes_ = bytes;
+    nextCompactionAt_ = std::max(journalOptions_.compact_threshold_bytes, 2 * bytes);
+    return journalFile_ != nullptr;
 }
 
-std::vector<DiffEntry> VersionedOopParser::getVersionDiff(size_t fromVersion, size_t toVersion) const {
-    std::lock_guard<std::mutex> lock(version_mutex_);
+// Internal helper - assumes lock is already held
+bool VersionedOopParser::journalVersion_unlocked(const VersionEntry& entry, const OopParser& state,
+                                                 bool forceCheckpoint) {
+    bool checkpoint = forceCheckpoint || !tipState_ ||
+                      recordsSinceCheckpoint_ + 1 >= journalOptions_.checkpoint_interval;
     
-    const VersionEntry* from = nullptr;
-    const VersionEntry* to = nullptr;
+    nlohmann::json record = checkpoint ? journalCheckpointRecord(entry, state)
+                                       : journalDeltaRecord(entry, entry.delta);
     
-    for (const auto& entry : versions_) {
-        if (entry.version == fromVersion) from = &entry;
-        if (entry.version == toVersion) to = &entry;
+    if (!writeJournalRecord_unlocked(record, checkpoint)) {
+        return false;
     }
+    recordsSinceCheckpoint_ = checkpoint ? 0 : recordsSinceCheckpoint_ + 1;
     
-    if (!from || !to) {
-        return {};  // Empty diff if versions not found
+    if (journalOptions_.compact_threshold_bytes > 0 && journalBytes_ >= nextCompactionAt_) {
+        startCompaction_unlocked();
     }
-    
-    // Use OopParser's diff method on the snapshots
-    std::vector<DiffEntry> result;
+    return true;
+}
+
+// Internal helper - assumes lock is already held
+bool VersionedOopParser::writeJournalRecord_unlocked(const nlohmann::json& record, bool checkpoint) {
+    std::string line;
     try {
-        // Compare using the snapshots
-        result = to->snapshot->diff(*from->snapshot);
+        line = record.dump() + "\n";
     } catch (const std::exception& e) {
-        std::cerr << "Error comparing versions: " << e.what() << std::endl;
+        std::cerr << "Error encoding journal record: " << e.what() << std::endl;
+        return false;
     }
     
-    return result;
+    bool sync = journalOptions_.sync_mode == JournalSyncMode::EVERY_RECORD ||
+                (journalOptions_.sync_mode == JournalSyncMode::CHECKPOINT && checkpoint);
+    bool written = std::fwrite(line.data(), 1, line.size(), journalFile_) == line.size() &&
+                   std::fflush(journalFile_) == 0;
+    if (!written || (sync && !syncFile(journalFile_))) {
+        std::cerr << "Failed to " << (written ? "sync" : "write") << " version journal: "
+                  << journalPath_ << std::endl;
+        
+        // Cut off whatever part of the record reached the file; the caller
+        // does not commit the change, so the journal must not keep it either
+        std::clearerr(journalFile_);
+        std::error_code ec;
+        std::filesystem::resize_file(journalPath_, journalBytes_, ec);
+        return false;
+    }
+    journalBytes_ += line.size();
+    return true;
 }
 
-nlohmann::json VersionedOopParser::getHistoryAsJson() const {
-    std::lock_guard<std::mutex> lock(version_mutex_);
-    
-    nlohmann::json history = nlohmann::json::array();
-    
-    for (const auto& entry : versions_) {
-        nlohmann::json versionJson = nlohmann::json::object();
-        versionJson["version"] = entry.version;
-        versionJson["timestamp"] = entry.timestamp;
-        versionJson["description"] = entry.description;
+// Internal helper - assumes lock is already held
+size_t VersionedOopParser::replayJournal_unlocked(std::istream& in, size_t& validBytes) {
+    size_t replayed = 0;
+    validBytes = 0;
+    
+    // Apply one record; false if it cannot be read or does not fit the history
+    auto replayRecord = [this](const std::string& line) {
+        nlohmann::json record = nlohmann::json::parse(line, nullptr, false);
+        if (record.is_discarded() || !record.is_object()) {
+            return false;
+        }
         
-        // Include section count
-        versionJson["sections"] = entry.snapshot->getAllSections().size();
+        std::string op = record.value("op", "");
+        size_t version = record.value("version", static_cast<size_t>(0));
+        if (op == "rollback") {
+            if (findVersionIndex_unlocked(version) == versions_.size()) {
+                return false;
+            }
+            currentVersion_ = version;
+            return true;
+        }
         
-        // Calculate total parameters
-        size_t paramCount = 0;
-        for (const auto& section : entry.snapshot->getAllSections()) {
-            paramCount += section.parameters.size();
+        size_t expected = versions_.empty() ? 0 : versions_.back().version + 1;
+        std::vector<DiffEntry> changes;
+        if (version == 0 || !decodeJournalChanges(record, changes)) {
+            return false;
         }
-        versionJson["parameters"] = paramCount;
         
-        history.push_back(versionJson);
-    }
+        auto state = std::make_shared<OopParser>();
+        bool reset = false;
+        if (op == "checkpoint") {
+            reset = version != expected;
+        } else if (op == "delta" && version == expected && tipState_) {
+            state->copyFrom(*tipState_);
+        } else {
+            return false;
+        }
+        if (!state->applyDiff(changes)) {
+            return false;
+        }
+        
+        if (reset) {
+            versions_.clear();
+            tipState_.reset();
+            historyBytes_ = 0;
+        }
+        VersionEntry entry(version, record.value("timestamp", ""), record.value("description", ""));
+        if (tipState_) {
+            entry.delta = tipState_->diff_impl(*state, false);
+        }
+        storeVersion_unlocked(std::move(entry), state, reset);
+        evictHistory_unlocked();
+        recordsSinceCheckpoint_ = op == "checkpoint" ? 0 : recordsSinceCheckpoint_ + 1;
+        return true;
+    };
     
+    std::string line;
+    size_t lineNumber = 0;
+    while (std::getline(in, line)) {
+        if (in.eof()) {
+            break;  // No trailing newline: torn final record
+        }
+        lineNumber++;
+        validBytes += line.size() + 1;
+        
+        bool applied = false;
+        try {
+            applied = replayRecord(line);
+        } catch (const std::exception&) {
+            applied = false;
+        }
+        if (applied) {
+            replayed++;
+        } else {
+            // Later records may still apply (a checkpoint resynchronizes deltas)
+            std::cerr << "Skipping unreadable record at line " << lineNumber
+                      << " of version journal" << std::endl;
+        }
+    }
+    return replayed;
+}
+
+// Internal helper - assumes lock is already held
+std::vector<std::pair<VersionEntry, std::shared_ptr<const OopParser>>>
+VersionedOopParser::captureHistory_unlocked() const {
+    std::vector<std::pair<VersionEntry, std::shared_ptr<const OopParser>>> history;
+    history.reserve(versions_.size());
+    
+    std::shared_ptr<const OopParser> state;
+    for (size_t i = 0; i < versions_.size(); ++i) {
+        const VersionEntry& entry = versions_[i];
+        if (entry.is_keyframe) {
+            state = entry.snapshot;
+        } else if (i == versions_.size() - 1 && tipState_) {
+            state = tipState_;
+        } else {
+            auto next = std::make_shared<OopParser>();
+            next->copyFrom(*state);
+            next->applyDiff(entry.delta);
+            state = next;
+        }
+        
+        VersionEntry meta(entry.version, entry.timestamp, entry.description);
+        meta.snapshot.reset();
+        meta.is_keyframe = entry.is_keyframe;
+        history.emplace_back(std::move(meta), state);
+    }
     return history;
 }
 
+bool VersionedOopParser::writeJournalHistory(FILE* file,
+    const std::vector<std::pair<VersionEntry, std::shared_ptr<const OopParser>>>& history,
+    size_t currentVersion, const JournalOptions& options, size_t& bytes) {
+    bytes = 0;
+    size_t sinceCheckpoint = 0;
+    
+    try {
+        for (size_t i = 0; i <= history.size(); ++i) {
+            nlohmann::json record;
+            bool checkpoint = false;
+            if (i == history.size()) {
+                // A rollback not followed by a new version
+                if (history.empty() || history.back().first.version == currentVersion) {
+                    break;
+                }
+                record = journalRollbackRecord(currentVersion);
+            } else {
+                const auto& [entry, state] = history[i];
+                checkpoint = i == 0 || sinceCheckpoint + 1 >= options.checkpoint_interval;
+                record = checkpoint
+                    ? journalCheckpointRecord(entry, *state)
+                    : journalDeltaRecord(entry, history[i - 1].second->diff_impl(*state, false));
+            }
+            
+            std::string line = record.dump() + "\n";
+            if (std::fwrite(line.data(), 1, line.size(), file) != line.size()) {
+                return false;
+            }
+            bytes += line.size();
+            sinceCheckpoint = checkpoint ? 0 : sinceCheckpoint + 1;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error encoding journal record: " << e.what() << std::endl;
+        return false;
+    }
+    return true;
+}
+
 } // namespace ioc_config
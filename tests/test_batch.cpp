@@ -420,6 +420,63 @@ bool testBatchStatisticsToString() {
     return true;
 }
 
+/**
+ * @brief Test parallel batch validation against a schema
+ */
+bool testBatchValidateAllWithSchema() {
+    std::string test_dir = "./test_batch_temp";
+    if (fs::exists(test_dir)) {
+        fs::remove_all(test_dir);
+    }
+    fs::create_directory(test_dir);
+    
+    std::string valid = "object.\nid = 17030\nname = x\n"
+                        "time.\nstart_date = a\nend_date = b\n"
+                        "search.\nmax_magnitude = 16.0\n";
+    std::vector<std::string> files;
+    for (int i = 0; i < 12; ++i) {
+        std::string path = test_dir + "/config" + std::to_string(i) + ".oop";
+        std::ofstream file(path);
+        file << valid;
+        if (i % 4 == 3) {
+            file << "propag.\nstep_size = 20\n";    // out of range
+        }
+        files.push_back(path);
+    }
+    files.push_back(test_dir + "/nonexistent.oop");
+    
+    BatchProcessor batch;
+    BatchStats stats = batch.validateAllWithSchema(files, OopParser::createDefaultSchema(), 4);
+    
+    assert(stats.total_files == 13);
+    assert(stats.successful_operations == 9);
+    assert(stats.failed_operations == 4);
+    assert(stats.file_results.size() == 13);
+    assert(stats.file_results[3].filepath == files[3]);
+    assert(stats.file_results[3].loaded);
+    assert(stats.file_results[3].issues.size() == 1);
+    assert(stats.file_results[3].issues[0].kind == ValidationIssue::Kind::INVALID_VALUE);
+    assert(stats.file_results[3].issues[0].key == "step_size");
+    assert(stats.file_results[0].issues.empty());
+    assert(!stats.file_results[12].loaded);
+    assert(stats.files_per_second > 0.0);
+    
+    // Single worker gives the same results
+    BatchStats serial = batch.validateAllWithSchema(files, OopParser::createDefaultSchema(), 1);
+    assert(serial.failed_files == stats.failed_files);
+    assert(batch.getLastStats().file_results.size() == 13);
+    
+    // Issues stay readable after the call (the compiled schema is gone)
+    const std::string expected = "Parameter 'step_size' in section 'propag' failed validation: "
+                                 "0.001..10 (value: 20)";
+    assert(stats.file_results[3].issues[0].toString() == expected);
+    assert(batch.getLastStats().file_results[7].issues[0].toString() == expected);
+    
+    fs::remove_all(test_dir);
+    return stats.successful_operations == 9 && serial.failed_files == stats.failed_files &&
+           stats.file_results[3].issues[0].toString() == expected;
+}
+
 int main(int argc, char** argv) {
     std::cout << "\n==================================================\n";
     std::cout << "  Testing Batch Operations Support (Phase 2B.1)\n";
@@ -456,6 +513,7 @@ int main(int argc, char** argv) {
     runTest("Batch get last stats", testBatchGetLastStats);
     runTest("Batch clear stats", testBatchClearStats);
     runTest("Batch statistics to string", testBatchStatisticsToString);
+    runTest("Batch validation with schema", testBatchValidateAllWithSchema);
     
     std::cout << "\n==================================================\n";
     std::cout << "Results: " << passed << " passed, " << failed << " failed\n";
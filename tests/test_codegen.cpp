@@ -0,0 +1,153 @@
+/**
+ * @file test_codegen.cpp
+ * @brief Tests for typed config structs generated from a ConfigSchema
+ *
+ * ioc_config_structs.h is written at build time by `ioc-config
+ * generate-structs` (see ioc_config_generate_structs in cmake/).
+ */
+
+#include "ioc_config/oop_parser.h"
+#include "ioc_config_structs.h"
+#include <iostream>
+#include <stdexcept>
+#include <chrono>
+
+using namespace ioc_config;
+
+void testGeneratedLoader() {
+    std::cout << "\n=== Test: Generated Loader ===\n";
+
+    OopParser parser;
+    parser.setParameter("object", "id", "'17030'");
+    parser.setParameter("object", "name", "'Test'");
+    parser.setParameter("time", "start_date", "60000.5");
+    parser.setParameter("time", "end_date", "60010.5");
+    parser.setParameter("search", "max_magnitude", "16.5");
+    parser.setParameter("propag", "step_size", "0.05");
+    parser.setParameter("propag", "unrelated", "ignored");
+
+    generated::Config config;
+    std::string error;
+    if (!generated::loadConfig(parser, config, &error)) {
+        throw std::runtime_error("loadConfig failed: " + error);
+    }
+    if (config.object.id != "'17030'" || config.time.end_date != "60010.5" ||
+        config.search.max_magnitude != 16.5 || config.propag.step_size != 0.05) {
+        throw std::runtime_error("Generated loader filled wrong values");
+    }
+    std::cout << "  load -> PASS\n";
+
+    // Failures use the validator's messages
+    parser.setParameter("search", "max_magnitude", "bright");
+    if (generated::loadConfig(parser, config, &error) || error.find("search.max_magnitude") == std::string::npos) {
+        throw std::runtime_error("Unconvertible value not reported: " + error);
+    }
+    parser.setParameter("search", "max_magnitude", "16.5");
+    parser.deleteByPath("/time/start_date");
+    if (generated::loadConfig(parser, config, &error) ||
+        error != "Missing required parameter 'start_date' in section 'time'") {
+        throw std::runtime_error("Missing parameter not reported: " + error);
+    }
+    std::cout << "  errors -> PASS\n";
+}
+
+void testGeneratedSource() {
+    std::cout << "\n=== Test: Generated Source ===\n";
+
+    SectionSpec section;
+    section.name = "run-options";
+    section.required = true;
+    ParameterSpec spec;
+    spec.key = ".class";
+    spec.type = "int";
+    spec.default_value = "4";
+    section.addParameter(spec);
+    spec.key = "verbose";
+    spec.type = "bool";
+    spec.default_value = ".TRUE.";
+    section.addParameter(spec);
+    spec.key = "label";
+    spec.type = "";
+    spec.default_value = "say \"hi\"";
+    section.addParameter(spec);
+    ConfigSchema schema;
+    schema.name = "custom";
+    schema.addSection(section);
+
+    std::string header = schema.toCppHeader("app", "Settings");
+    for (const char* expected : {"namespace app {", "struct RunOptionsSection {", "int class_ = 4;",
+                                 "bool verbose = true;", "std::string label = \"say \\\"hi\\\"\";",
+                                 "RunOptionsSection run_options;", "inline bool loadSettings(",
+                                 "failure = \"Missing required section: run-options\";"}) {
+        if (header.find(expected) == std::string::npos) {
+            throw std::runtime_error(std::string("Generated header lacks: ") + expected);
+        }
+    }
+    std::cout << "  identifiers, types and defaults -> PASS\n";
+
+    // A schema read back from its JSON Schema generates the same code
+    for (const ConfigSchema& original : {schema, OopParser::createDefaultSchema()}) {
+        ConfigSchema loaded;
+        if (!loaded.fromJsonSchema(original.toJsonSchema()) ||
+            loaded.toCppHeader("app", "Settings") != original.toCppHeader("app", "Settings")) {
+            throw std::runtime_error("JSON Schema round trip changed the generated header for " + original.name);
+        }
+    }
+    ConfigSchema untouched = schema;
+    if (untouched.fromJsonSchema(nlohmann::json::array()) || untouched.loadJsonSchema("missing_schema.json") ||
+        untouched.toCppHeader() != schema.toCppHeader()) {
+        throw std::runtime_error("Invalid JSON Schema should leave the schema unchanged");
+    }
+    std::cout << "  JSON Schema round trip -> PASS\n";
+}
+
+void testFieldAccessThroughput() {
+    std::cout << "\n=== Test: Field Access vs Key Lookup ===\n";
+
+    OopParser parser;
+    parser.setParameter("object", "id", "'17030'");
+    parser.setParameter("object", "name", "'Test'");
+    parser.setParameter("time", "start_date", "60000.5");
+    parser.setParameter("time", "end_date", "60010.5");
+    parser.setParameter("search", "max_magnitude", "16.5");
+    generated::Config config;
+    if (!generated::loadConfig(parser, config)) {
+        throw std::runtime_error("loadConfig failed");
+    }
+
+    const size_t reads = 200000;
+    double lookup_sum = 0.0, field_sum = 0.0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < reads; ++i) {
+        lookup_sum += parser.getSection("search")->parameters.at("max_magnitude").asDouble();
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < reads; ++i) {
+        field_sum += config.search.max_magnitude;
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    if (lookup_sum != field_sum) {
+        throw std::runtime_error("Field reads disagree with key lookups");
+    }
+    std::cout << "  " << reads << " reads: key lookup "
+              << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms, struct field "
+              << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms\n";
+}
+
+int main() {
+    std::cout << "IOC_Config - Generated Struct Tests\n";
+    std::cout << "===================================\n";
+
+    try {
+        testGeneratedLoader();
+        testGeneratedSource();
+        testFieldAccessThroughput();
+
+        std::cout << "\n===================================\n";
+        std::cout << "All tests completed! ✓\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test error: " << e.what() << "\n";
+        return 1;
+    }
+}
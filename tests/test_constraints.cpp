@@ -1,6 +1,12 @@
 #include "ioc_config/oop_parser.h"
 #include <iostream>
 #include <iomanip>
+#include <stdexcept>
+#include <functional>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <cstdio>
 
 using namespace ioc_config;
 
@@ -182,6 +188,534 @@ void testConstraintParsing() {
     }
 }
 
+void testCompiledSchema() {
+    std::cout << "\n=== Test: Compiled Schema ===\n";
+    
+    ConfigSchema schema = OopParser::createDefaultSchema();
+    ParameterSpec mode;
+    mode.key = "mode";
+    mode.required = true;
+    mode.allowed_values = {"fast", "precise"};
+    schema.sections["search"].addParameter(mode);
+    schema.sections["search"].params["max_magnitude"].required = true;
+    CompiledSchema compiled(schema);
+    
+    // Same verdicts and messages as the uncompiled validator
+    std::vector<std::vector<std::string>> configs = {
+        {"object/id=17030", "object/name=x", "time/start_date=a", "time/end_date=b",
+         "search/max_magnitude=16.0", "search/mode=fast"},
+        {"object/id=17030", "search/max_magnitude=25", "search/mode=slow"},
+        {"search/max_magnitude=abc", "search/mode=precise"},
+        {"search/max_magnitude=1e999", "time/start_date=a"},
+        {}
+    };
+    for (const auto& entries : configs) {
+        OopParser parser;
+        for (const auto& entry : entries) {
+            size_t slash = entry.find('/'), eq = entry.find('=');
+            parser.setParameter(entry.substr(0, slash), entry.substr(slash + 1, eq - slash - 1),
+                                entry.substr(eq + 1));
+        }
+        
+        std::vector<std::string> expected, actual;
+        bool expected_ok = parser.validateWithSchema(schema, expected);
+        bool actual_ok = parser.validateWithSchema(compiled, actual);
+        std::cout << "  " << entries.size() << " parameters -> " << actual.size() << " errors";
+        if (expected_ok != actual_ok || expected != actual) {
+            std::cout << " -> FAIL\n";
+            throw std::runtime_error("Compiled schema disagrees with validateWithSchema");
+        }
+        std::cout << " -> PASS\n";
+    }
+    
+    if (!compiled.isValueValid("propag", "step_size", "0.5") ||
+        compiled.isValueValid("propag", "step_size", "20") ||
+        !compiled.isValueValid("unknown", "key", "anything")) {
+        throw std::runtime_error("CompiledSchema::isValueValid gave a wrong verdict");
+    }
+    std::cout << "  isValueValid -> PASS\n";
+}
+
+void testFullValidation() {
+    std::cout << "\n=== Test: Full Validation ===\n";
+    
+    using Kind = ValidationIssue::Kind;
+    CompiledSchema compiled(OopParser::createDefaultSchema());
+    
+    OopParser parser;
+    parser.setParameter("object", "id", "17030");
+    parser.setParameter("object", "name", "x");
+    parser.setParameter("object", "colour", "red");         // unknown key
+    parser.setParameter("time", "start_date", "a");         // end_date missing
+    parser.setParameter("propag", "step_size", "20");       // optional but out of range
+    parser.setParameter("extras", "note", "hi");            // unknown section
+    
+    std::vector<ValidationIssue> issues;
+    bool ok = parser.validateFull(compiled, issues);
+    
+    std::vector<std::pair<Kind, std::string>> expected = {
+        {Kind::UNKNOWN_PARAMETER, "object/colour"},
+        {Kind::MISSING_PARAMETER, "time/end_date"},
+        {Kind::INVALID_VALUE, "propag/step_size"},
+        {Kind::UNKNOWN_SECTION, "extras/"},
+        {Kind::MISSING_SECTION, "search/"}
+    };
+    bool match = !ok && issues.size() == expected.size();
+    for (size_t i = 0; match && i < issues.size(); ++i) {
+        std::cout << "  " << issues[i].toString() << "\n";
+        match = issues[i].kind == expected[i].first &&
+                issues[i].section + "/" + issues[i].key == expected[i].second;
+    }
+    if (!match) {
+        throw std::runtime_error("validateFull reported unexpected issues");
+    }
+    if (issues[2].value != "20" || issues[2].constraint != "0.001..10") {
+        throw std::runtime_error("validateFull lost the offending value or constraint");
+    }
+    
+    // Issues own their text: they outlive a temporary CompiledSchema
+    std::vector<ValidationIssue> detached;
+    parser.validateFull(CompiledSchema(OopParser::createDefaultSchema()), detached);
+    if (detached.size() != issues.size() || detached[2].toString() != issues[2].toString()) {
+        throw std::runtime_error("Issues from a temporary CompiledSchema lost their constraint text");
+    }
+    std::cout << "  " << issues.size() << " issues -> PASS\n";
+    
+    // Every legacy error is also reported by the full pass
+    std::vector<std::string> legacy;
+    parser.validateWithSchema(compiled, legacy);
+    for (const auto& error : legacy) {
+        bool found = false;
+        for (const auto& issue : issues) {
+            found = found || issue.toString().rfind(error, 0) == 0;
+        }
+        if (!found) {
+            throw std::runtime_error("validateFull missed: " + error);
+        }
+    }
+    std::cout << "  covers validateWithSchema errors -> PASS\n";
+}
+
+void testIncrementalValidation() {
+    std::cout << "\n=== Test: Incremental Revalidation ===\n";
+    
+    ConfigSchema schema = OopParser::createDefaultSchema();
+    CompiledSchema compiled(schema);
+    OopParser parser;
+    if (!parser.revalidate()) {
+        throw std::runtime_error("revalidate without a schema should succeed");
+    }
+    parser.setSchema(schema);
+    
+    // After every edit the cumulative state must equal a fresh full validation
+    std::vector<std::function<void()>> edits = {
+        [&] { parser.setParameter("object", "id", "17030"); },
+        [&] { parser.setParameter("object", "name", "x"); },
+        [&] { parser.setParameter("time", "start_date", "a"); },
+        [&] { parser.setParameter("propag", "step_size", "20"); },
+        [&] { parser.setValueByPath("/propag/step_size", "0.5"); },
+        [&] { parser.setValueByPath(PathHandle("/propag/step_size"), "50"); },
+        [&] { parser.setParameter("time", "end_date", "b"); },
+        [&] { parser.setParameter("search", "max_magnitude", "16"); },
+        [&] { parser.setParameter("extras", "note", "hi"); },
+        [&] { parser.deleteByPath("/extras"); },
+        [&] { parser.setValueByPath(PathHandle("/propag/step_size"), "5"); },
+        [&] { parser.deleteByPath("/time/end_date"); },
+        [&] { parser.setParameter("time", "end_date", "c"); },
+        [&] { parser.clear(); }
+    };
+    
+    std::vector<ValidationIssue> incremental, full;
+    for (size_t i = 0; i < edits.size(); ++i) {
+        edits[i]();
+        bool inc_ok = parser.revalidate(incremental);
+        bool full_ok = parser.validateFull(compiled, full);
+        bool same = inc_ok == full_ok && inc_ok == parser.revalidate() &&
+                    incremental.size() == full.size();
+        for (size_t k = 0; same && k < full.size(); ++k) {
+            same = incremental[k].toString() == full[k].toString();
+        }
+        std::cout << "  edit " << i << ": " << incremental.size() << " issues";
+        if (!same) {
+            std::cout << " -> FAIL\n";
+            throw std::runtime_error("revalidate disagrees with validateFull");
+        }
+        std::cout << " -> PASS\n";
+        if (i == 12 && !inc_ok) {
+            throw std::runtime_error("Configuration should be valid after edit 12");
+        }
+    }
+}
+
+void testConstraintCacheAndThroughput() {
+    std::cout << "\n=== Test: Constraint Cache and Throughput ===\n";
+    using Clock = std::chrono::steady_clock;
+    
+    // Cached parses agree with uncached ones
+    RangeConstraint::clearExpressionCache();
+    std::vector<std::string> exprs = {"1..100", "1..N", "d >= 4", "d<1000", "5 < d < 30", "30 > d > 5", "bogus"};
+    for (int round = 0; round < 2; ++round) {
+        for (const auto& expr : exprs) {
+            RangeConstraint cached, fresh;
+            bool ok = cached.parseExpression(expr);
+            if (ok != fresh.parseExpressionUncached(expr) || cached.enabled != fresh.enabled ||
+                cached.min_value != fresh.min_value || cached.max_value != fresh.max_value ||
+                cached.min_inclusive != fresh.min_inclusive || cached.max_inclusive != fresh.max_inclusive ||
+                cached.is_range_to_catalog != fresh.is_range_to_catalog || cached.toString() != fresh.toString()) {
+                throw std::runtime_error("Cached parse differs for '" + expr + "'");
+            }
+        }
+    }
+    if (RangeConstraint::getExpressionCacheSize() != exprs.size() - 1) {
+        throw std::runtime_error("Expected one cache entry per valid expression");
+    }
+    std::cout << "  " << RangeConstraint::getExpressionCacheSize() << " expressions interned -> PASS\n";
+    
+    const size_t parses = 100000;
+    auto t0 = Clock::now();
+    for (size_t i = 0; i < parses; ++i) {
+        RangeConstraint c;
+        c.parseExpressionUncached("5 < d < 30");
+    }
+    auto t1 = Clock::now();
+    for (size_t i = 0; i < parses; ++i) {
+        RangeConstraint c;
+        c.parseExpression("5 < d < 30");
+    }
+    auto t2 = Clock::now();
+    std::cout << "  " << parses << " parses: uncached "
+              << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms, cached "
+              << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms\n";
+    
+    // Benchmark: 10M values against an exclusive/inclusive mixed range
+    RangeConstraint range;
+    range.parseExpression("5 < d < 30");
+    range.max_inclusive = true;
+    const size_t count = 10000000;
+    std::vector<double> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = static_cast<double>((i * 2654435761u) % 4000) / 100.0;  // 0.00 .. 39.99
+    }
+    values[0] = 5.0;
+    values[1] = 30.0;
+    values[2] = std::nan("");
+    
+    size_t reference = 0;
+    for (double v : values) {
+        reference += (v > range.min_value) && (v <= range.max_value);
+    }
+    t0 = Clock::now();
+    size_t satisfied = 0;
+    for (double v : values) {
+        satisfied += range.isSatisfied(v);
+    }
+    double ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+    std::cout << "  " << count << " values: " << satisfied << " satisfied in " << ms << " ms ("
+              << count / ms / 1000.0 << " M values/s)";
+    if (satisfied != reference || range.isSatisfied(5.0) || !range.isSatisfied(30.0) ||
+        range.isSatisfied(std::nan(""))) {
+        std::cout << " -> FAIL\n";
+        throw std::runtime_error("isSatisfied disagrees with the reference comparison");
+    }
+    std::cout << " -> PASS\n";
+}
+
+void testBulkConstraintChecks() {
+    std::cout << "\n=== Test: Bulk Constraint Checks ===\n";
+    
+    // Vector and scalar paths agree for every length (tails included) and inclusivity
+    for (int mode = 0; mode < 4; ++mode) {
+        RangeConstraint range;
+        range.parseExpression("1..10");
+        range.min_inclusive = mode & 1;
+        range.max_inclusive = mode & 2;
+        for (size_t length = 0; length < 40; ++length) {
+            std::vector<double> values(length);
+            for (size_t i = 0; i < length; ++i) {
+                values[i] = static_cast<double>((i * 7 + mode) % 13);   // 0..12, hits both bounds
+            }
+            if (length > 5) values[5] = std::nan("");
+            
+            std::vector<size_t> expected, actual;
+            for (size_t i = 0; i < length; ++i) {
+                if (!range.isSatisfied(values[i])) expected.push_back(i);
+            }
+            size_t found = range.findViolations(values.data(), values.size(), actual);
+            if (actual != expected || found != expected.size()) {
+                throw std::runtime_error("findViolations disagrees with isSatisfied");
+            }
+        }
+    }
+    std::cout << "  findViolations matches isSatisfied -> PASS\n";
+    
+    std::vector<double> parsed;
+    bool numeric = OopParser::parseNumericArray(" [1.5, 2 ,3.0D1, x, 40,] ", parsed);
+    if (numeric || parsed.size() != 6 || parsed[0] != 1.5 || parsed[2] != 30.0 ||
+        !std::isnan(parsed[3]) || parsed[4] != 40.0 || !std::isnan(parsed[5]) ||
+        !OopParser::parseNumericArray("1e-3,2", parsed) || parsed.size() != 2 ||
+        !OopParser::parseNumericArray("[]", parsed) || !parsed.empty()) {
+        throw std::runtime_error("parseNumericArray gave unexpected elements");
+    }
+    std::cout << "  parseNumericArray -> PASS\n";
+    
+    ParameterSpec bins;
+    bins.key = "magnitude_bins";
+    bins.constraint.parseExpression("0..20");
+    std::vector<size_t> violations;
+    if (bins.findArrayViolations("[10, 12.5, 21, abc, 0, 20]", violations) ||
+        violations != std::vector<size_t>{2, 3} ||
+        !bins.findArrayViolations("[1, 2, 3]", violations) || !violations.empty()) {
+        throw std::runtime_error("findArrayViolations reported wrong indices");
+    }
+    ParameterSpec observers;
+    observers.allowed_values = {"500", "G96", "I41"};
+    if (observers.findArrayViolations("[500, XXX, I41]", violations) || violations != std::vector<size_t>{1}) {
+        throw std::runtime_error("findArrayViolations ignored allowed values");
+    }
+    std::cout << "  findArrayViolations -> PASS\n";
+    
+    const size_t count = 10000000;
+    std::vector<double> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = static_cast<double>((i * 2654435761u) % 2100) / 100.0;  // 0.00 .. 20.99
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    violations.clear();
+    bins.constraint.findViolations(values.data(), values.size(), violations);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    std::cout << "  " << count << " values: " << violations.size() << " violations in " << ms << " ms ("
+              << count / ms / 1000.0 << " M values/s)\n";
+}
+
+void testCrossConstraints() {
+    std::cout << "\n=== Test: Cross-Parameter Constraints ===\n";
+    
+    // Compilation and evaluation
+    CrossConstraint rule("search.max_mag >= search.min_mag + 2 AND NOT (search.min_mag < 0)");
+    double values[] = {17.0, 14.0};
+    if (!rule.isValid() || rule.getReferences().size() != 2 ||
+        rule.getReferences()[0] != CrossConstraint::Reference("search", "max_mag") ||
+        !rule.evaluate(values)) {
+        throw std::runtime_error("Cross constraint failed to compile or evaluate: " + rule.getError());
+    }
+    values[0] = 15.5;
+    if (rule.evaluate(values)) {
+        throw std::runtime_error("Cross constraint should fail for 15.5 < 14 + 2");
+    }
+    // Keywords end at a word boundary: these are references, not NOT/AND/OR
+    CrossConstraint prefixed("not_used.x >= 1 and and.y < or.z");
+    if (!prefixed.isValid() || prefixed.getReferences().size() != 3 ||
+        prefixed.getReferences()[0] != CrossConstraint::Reference("not_used", "x") ||
+        prefixed.getReferences()[1] != CrossConstraint::Reference("and", "y")) {
+        throw std::runtime_error("Keyword prefix misread as an operator: " + prefixed.getError());
+    }
+    for (const char* bad : {"time.end >", "end > 3", "(a.b > 1", "a.b > 1 junk", ""}) {
+        if (CrossConstraint(bad).isValid()) {
+            throw std::runtime_error(std::string("Expression should not compile: ") + bad);
+        }
+    }
+    CrossConstraint arithmetic("-(a.x - 2) * 3 / 2 == -1.5 || a.x != a.x");
+    double x = 3.0;
+    if (!arithmetic.evaluate(&x)) {
+        throw std::runtime_error("Arithmetic precedence evaluated wrongly");
+    }
+    std::cout << "  compile/evaluate -> PASS\n";
+    
+    // Integrated into the validators
+    ConfigSchema schema = OopParser::createDefaultSchema();
+    if (!schema.addConstraint("time.end_date > time.start_date") ||
+        !schema.addConstraint("search.max_magnitude >= 10") || schema.addConstraint("broken >")) {
+        throw std::runtime_error("addConstraint accepted or rejected the wrong expressions");
+    }
+    CompiledSchema compiled(schema);
+    
+    OopParser parser;
+    parser.setParameter("object", "id", "17030");
+    parser.setParameter("object", "name", "x");
+    parser.setParameter("time", "start_date", "'2025-12-31'");   // YYYY-MM-DD, as the schema documents
+    parser.setParameter("time", "end_date", "'2025-12-01'");
+    parser.setParameter("search", "max_magnitude", "16");
+    parser.setSchema(schema);
+    
+    std::vector<std::string> legacy, fast;
+    std::vector<ValidationIssue> full, incremental;
+    parser.validateWithSchema(schema, legacy);
+    parser.validateWithSchema(compiled, fast);
+    parser.validateFull(compiled, full);
+    parser.revalidate(incremental);
+    if (legacy != std::vector<std::string>{"Constraint violated: time.end_date > time.start_date"} ||
+        fast != legacy || full.size() != 1 || full[0].kind != ValidationIssue::Kind::CONSTRAINT_VIOLATED ||
+        full[0].toString() != legacy[0] || incremental.size() != 1) {
+        throw std::runtime_error("Cross constraint not reported consistently");
+    }
+    
+    parser.setParameter("time", "end_date", "2026-01-10T12:00");
+    parser.setParameter("search", "max_magnitude", "9");
+    if (parser.validateWithSchema(compiled, fast) || fast.size() != 1 ||
+        fast[0] != "Constraint violated: search.max_magnitude >= 10" || parser.revalidate(incremental) ||
+        incremental.size() != 1) {
+        throw std::runtime_error("Cross constraint results did not follow edits");
+    }
+    parser.deleteByPath("/search/max_magnitude");
+    if (!parser.revalidate()) {
+        throw std::runtime_error("Constraints on absent parameters should be skipped");
+    }
+    
+    // Dates compare as MJD, so they mix with MJD numbers; other text fails
+    OopParser dates;
+    dates.setParameter("time", "start_date", "2025-12-01");
+    dates.setParameter("time", "end_date", "61010.5");
+    ConfigSchema date_schema;
+    date_schema.addConstraint("time.end_date - time.start_date == 0.5");
+    if (!dates.validateWithSchema(date_schema, legacy)) {
+        throw std::runtime_error("ISO date not read as MJD");
+    }
+    dates.setParameter("time", "start_date", "2025-13-01");
+    if (dates.validateWithSchema(date_schema, legacy)) {
+        throw std::runtime_error("Invalid date should fail the constraint");
+    }
+    std::cout << "  validateWithSchema/validateFull/revalidate -> PASS\n";
+    
+    // JSON Schema export
+    nlohmann::json exported = schema.toJsonSchema();
+    const auto& magnitude = exported["properties"]["search"]["properties"]["max_magnitude"];
+    if (exported["constraints"].size() != 2 || magnitude["minimum"] != 10.0 || magnitude["exclusiveMaximum"] != 20.0) {
+        throw std::runtime_error("toJsonSchema did not export the constraints");
+    }
+    std::cout << "  toJsonSchema -> PASS\n";
+    
+    // Evaluation throughput over many configurations
+    const size_t evaluations = 1000000;
+    double inputs[] = {0.0, 0.0};
+    size_t satisfied = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < evaluations; ++i) {
+        inputs[0] = static_cast<double>(i % 20);
+        inputs[1] = static_cast<double>(i % 17);
+        satisfied += rule.evaluate(inputs);
+    }
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    std::cout << "  " << evaluations << " evaluations (" << satisfied << " satisfied) in " << ms << " ms\n";
+}
+
+void testSchemaTypedLoading() {
+    std::cout << "\n=== Test: Schema-Typed Loading ===\n";
+    
+    SectionSpec search;
+    search.name = "search";
+    auto addSpec = [&search](const std::string& key, const std::string& type, const std::string& def) {
+        ParameterSpec spec;
+        spec.key = key;
+        spec.type = type;
+        spec.default_value = def;
+        search.addParameter(spec);
+    };
+    addSpec("max_magnitude", "float", "");
+    addSpec("count", "int", "");
+    addSpec("enabled", "bool", ".TRUE.");
+    addSpec("mode", "string", "fast");
+    addSpec("limit", "int", "");
+    ConfigSchema schema;
+    schema.addSection(search);
+    
+    // Absent from every source: the optional one is created from its defaults
+    SectionSpec output;
+    output.name = "output";
+    ParameterSpec format;
+    format.key = "format";
+    format.type = "string";
+    format.default_value = "text";
+    output.addParameter(format);
+    schema.addSection(output);
+    SectionSpec object = output;
+    object.name = "object";
+    object.required = true;
+    schema.addSection(object);
+    
+    auto check = [](const OopParser& parser, const std::string& source) {
+        const ConfigSectionData* defaults = parser.getSection("output");
+        if (!defaults || defaults->parameters.size() != 1 ||
+            defaults->parameters.at("format").value != "text" || parser.getSection("object")) {
+            throw std::runtime_error(source + ": defaults of absent sections not applied as expected");
+        }
+        const ConfigSectionData* section = parser.getSection("search");
+        if (!section) {
+            throw std::runtime_error(source + ": search section not loaded");
+        }
+        auto param = [&](const std::string& key) -> const ConfigParameter& {
+            auto it = section->parameters.find(key);
+            if (it == section->parameters.end()) {
+                throw std::runtime_error(source + ": missing " + key);
+            }
+            return it->second;
+        };
+        if (param("max_magnitude").type != "float" || param("max_magnitude").asDouble() != 16.0 ||
+            param("count").type != "int" || param("count").asInt() != 3 ||
+            param("enabled").type != "bool" || !param("enabled").asBoolean() ||
+            param("mode").value != "fast" || param("mode").type != "string") {
+            throw std::runtime_error(source + ": declared types not applied or defaults missing");
+        }
+        // Unparsable and undeclared values keep the detected type
+        if (param("limit").type != "string" || param("extra").type != "float") {
+            throw std::runtime_error(source + ": fallback to detectType failed");
+        }
+    };
+    
+    const std::string path = "test_typed_loading.oop";
+    {
+        std::ofstream out(path);
+        out << "search.\n    max_magnitude = 16\n    count = 3\n    limit = abc\n    extra = 2.5\n";
+    }
+    OopParser oop;
+    oop.setSchema(schema);
+    oop.setSchemaTypedLoading(true);
+    if (!oop.loadFromOop(path)) {
+        throw std::runtime_error("loadFromOop failed: " + oop.getLastError());
+    }
+    std::remove(path.c_str());
+    check(oop, "OOP");
+    
+    OopParser json;
+    json.setSchema(schema);
+    json.setSchemaTypedLoading(true);
+    if (!json.loadFromJsonString(R"({"search": {"max_magnitude": 16, "count": 3, "limit": "abc", "extra": 2.5}})")) {
+        throw std::runtime_error("loadFromJsonString failed: " + json.getLastError());
+    }
+    check(json, "JSON");
+    
+    const std::string json_path = "test_typed_loading.json";
+    {
+        std::ofstream out(json_path);
+        out << R"({"search": {"max_magnitude": 16, "count": 3, "limit": "abc", "extra": 2.5}})";
+    }
+    OopParser json_file;
+    json_file.setSchema(schema);
+    json_file.setSchemaTypedLoading(true);
+    if (!json_file.loadFromJson(json_path)) {
+        throw std::runtime_error("loadFromJson failed: " + json_file.getLastError());
+    }
+    std::remove(json_path.c_str());
+    check(json_file, "JSON file");
+    std::cout << "  types, defaults, absent sections and fallback (OOP, JSON, JSON file) -> PASS\n";
+    
+    // Accessors read the value itself, including direct writes to the field
+    ConfigParameter* magnitude = oop.getSection("search")->getParameter("max_magnitude");
+    magnitude->value = "12.0";
+    if (magnitude->asDouble() != 12.0) {
+        throw std::runtime_error("Accessor ignored a direct value write");
+    }
+    
+    // Without a schema the mode changes nothing
+    OopParser plain;
+    plain.setSchemaTypedLoading(true);
+    plain.loadFromJsonString(R"({"search": {"max_magnitude": 16}})");
+    if (plain.getSection("search")->parameters.at("max_magnitude").type != "int" ||
+        plain.getSection("search")->parameters.count("enabled")) {
+        throw std::runtime_error("Typed loading applied without a schema");
+    }
+    std::cout << "  direct writes and opt-in -> PASS\n";
+}
+
 int main() {
     std::cout << "IOC_Config - Advanced Validation and Constraints Tests\n";
     std::cout << "======================================================\n";
@@ -192,6 +726,13 @@ int main() {
         testParameterSpecs();
         testSectionSpecs();
         testSchemaValidation();
+        testCompiledSchema();
+        testFullValidation();
+        testIncrementalValidation();
+        testConstraintCacheAndThroughput();
+        testBulkConstraintChecks();
+        testCrossConstraints();
+        testSchemaTypedLoading();
         
         std::cout << "\n======================================================\n";
         std::cout << "All tests completed! ✓\n";
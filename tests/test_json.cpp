@@ -1,6 +1,7 @@
 #include "ioc_config/oop_parser.h"
 #include <iostream>
 #include <fstream>
+#include <stdexcept>
 
 using namespace ioc_config;
 
@@ -127,6 +128,105 @@ void testValidation() {
     }
 }
 
+void testSchemaValidation() {
+    std::cout << "\n=== Test: Compiled JSON Schema Validation ===\n";
+    
+    nlohmann::json schema = nlohmann::json::parse(R"({
+        "type": "object",
+        "required": ["object", "search"],
+        "additionalProperties": false,
+        "properties": {
+            "object": {
+                "type": "object",
+                "required": ["id", "name"],
+                "properties": {"id": {"type": "integer", "minimum": 1}}
+            },
+            "search": {
+                "type": "object",
+                "additionalProperties": {"type": "number"},
+                "properties": {
+                    "max_magnitude": {"type": "number", "exclusiveMaximum": 20},
+                    "mode": {"enum": ["fast", "precise"]},
+                    "verbose": {"type": "boolean"}
+                }
+            },
+            "time": true
+        },
+        "constraints": ["search.max_magnitude >= search.min_magnitude"]
+    })");
+    CompiledJsonSchema compiled(schema);
+    if (!compiled.isValid()) {
+        throw std::runtime_error("Schema did not compile: " + compiled.getError());
+    }
+    
+    OopParser parser;
+    parser.setParameter("object", "id", "17030");
+    parser.setParameter("object", "name", "'Asteroid'");
+    parser.setParameter("search", "max_magnitude", "16.5");
+    parser.setParameter("search", "min_magnitude", "10");
+    parser.setParameter("search", "mode", "'fast'");
+    parser.setParameter("search", "verbose", ".TRUE.");
+    parser.setParameter("time", "anything", "goes");
+    
+    std::vector<std::string> errors;
+    if (!parser.validateAgainstSchema(compiled, errors)) {
+        for (const auto& err : errors) std::cout << "  - " << err << "\n";
+        throw std::runtime_error("Valid configuration was rejected");
+    }
+    std::cout << "✓ Valid configuration accepted\n";
+    
+    parser.setParameter("object", "id", "1.5");                  // not an integer
+    parser.setParameter("search", "max_magnitude", "20");        // exclusiveMaximum
+    parser.setParameter("search", "min_magnitude", "'low'");     // additionalProperties type
+    parser.setParameter("search", "mode", "slow");               // enum
+    parser.setParameter("extra", "key", "1");                    // additional section
+    std::vector<std::string> expected = {
+        "/object/id: expected integer, got '1.5'",
+        "/search/max_magnitude: 20 is not less than exclusiveMaximum 20.0",
+        "/search/min_magnitude: expected number, got ''low''",
+        "/search/mode: value 'slow' is not one of the enum values",
+        "/extra: additional property not allowed",
+        "/: constraint violated: search.max_magnitude >= search.min_magnitude"
+    };
+    parser.validateAgainstSchema(compiled, errors);
+    std::vector<std::string> uncompiled;
+    parser.validateAgainstSchema(schema, uncompiled);
+    if (errors != expected || uncompiled != errors) {
+        for (const auto& err : errors) std::cout << "  - " << err << "\n";
+        throw std::runtime_error("Unexpected JSON schema errors");
+    }
+    std::cout << "✓ " << errors.size() << " violations reported\n";
+    
+    OopParser empty;
+    empty.validateAgainstSchema(compiled, errors);
+    if (errors != std::vector<std::string>{"/: missing required property 'object'",
+                                           "/: missing required property 'search'"}) {
+        throw std::runtime_error("Missing sections not reported");
+    }
+    if (CompiledJsonSchema(nlohmann::json::parse(R"({"type": "text"})")).isValid() ||
+        empty.validateAgainstSchema(nlohmann::json::parse(R"({"minimum": "x"})"), errors)) {
+        throw std::runtime_error("Malformed schema accepted");
+    }
+    
+    // Schemas exported from ConfigSchema validate matching configurations
+    ConfigSchema config_schema = OopParser::createDefaultSchema();
+    config_schema.addConstraint("propag.step_size <= 5");
+    parser.clear();
+    parser.setParameter("object", "id", "17030");
+    parser.setParameter("object", "name", "'Asteroid'");
+    parser.setParameter("time", "start_date", "60000");
+    parser.setParameter("time", "end_date", "60007");
+    parser.setParameter("search", "max_magnitude", "16.5");
+    parser.setParameter("propag", "step_size", "7");
+    parser.validateAgainstSchema(config_schema.toJsonSchema(), errors);
+    if (errors != std::vector<std::string>{"/propag/step_size: 7 is greater than maximum 5.0",
+                                           "/: constraint violated: propag.step_size <= 5"}) {
+        for (const auto& err : errors) std::cout << "  - " << err << "\n";
+        throw std::runtime_error("Exported schema did not round-trip");
+    }
+    std::cout << "✓ Exported ConfigSchema round-trips\n";
+}
+
 int main() {
     std::cout << "IOC_Config - JSON Functionality Tests\n";
     std::cout << "=====================================\n";
@@ -137,6 +237,7 @@ int main() {
         testJsonObjectConversion();
         testBidirectionalConversion();
         testValidation();
+        testSchemaValidation();
         
         std::cout << "\n=====================================\n";
         std::cout << "All JSON tests completed! ✓\n";
@@ -14,8 +14,13 @@
 
 #include "ioc_config/oop_parser.h"
 #include <iostream>
+#include <atomic>
 #include <cassert>
 #include <sstream>
+#include <regex>
+#include <vector>
+#include <functional>
+#include <stdexcept>
 
 using namespace ioc_config;
 
@@ -167,6 +172,31 @@ bool testDiffJson() {
     return true;
 }
 
+/**
+ * @brief Test applyDiff reproduces the target configuration
+ */
+bool testApplyDiff() {
+    OopParser config1, config2;
+    
+    config1.setParameter("object", "id", "17030");
+    config1.setParameter("object", "name", "Old");
+    config1.setParameter("output", "format", "JSON");
+    config2.setParameter("object", "id", "17031");
+    config2.setParameter("search", "mag", "16.5");
+    
+    assert(config1.applyDiff(config1.diff(config2)) && "applyDiff should succeed");
+    
+    assert(config1.diff(config2).size() == 2 && "Only unchanged entries should remain");
+    for (const auto& entry : config1.diff(config2)) {
+        assert(entry.type == DiffEntry::UNCHANGED && "Configurations should match");
+    }
+    assert(config1.getSection("output") == nullptr && "Emptied section should be removed");
+    assert(config1.getSection("search")->getParameter("mag")->type == "float" &&
+           "Type should be carried over");
+    
+    return true;
+}
+
 /**
  * @brief Test clone functionality
  */
@@ -214,6 +244,46 @@ bool testCopyFrom() {
     return true;
 }
 
+/**
+ * @brief Test that copies share sections until one side writes
+ */
+bool testCopyOnWrite() {
+    OopParser source;
+    source.setParameter("object", "id", "17030");
+    source.setParameter("search", ".max_magnitude", "17.0");
+    
+    auto copy = source.clone();
+    auto diff = source.diff(*copy);
+    assert(diff.size() == 2 && "Shared sections should diff as unchanged");
+    
+    // Writes through each access path must not leak into the other copy
+    copy->getSection("object")->getParameter("id")->value = "1";
+    copy->setValueByPath("/search/.max_magnitude", "18.0");
+    copy->findParameter(".max_magnitude")->value = "19.0";
+    source.deleteByPath("/object/id");
+    
+    assert(source.getValueByPath("/search/.max_magnitude") == "17.0" &&
+           "Source should be unchanged");
+    assert(source.getSection("object")->getParameter("id") == nullptr &&
+           "Delete should only affect source");
+    assert(copy->getValueByPath("/object/id") == "1" && "Copy should keep its edit");
+    assert(copy->getValueByPath("/search/.max_magnitude") == "19.0" &&
+           "Copy should keep its edit");
+    
+    // Pointers taken before a copy must not reach into it either
+    ConfigSectionData* held = source.getSection("search");
+    ConfigParameter* found = source.findParameter(".max_magnitude");
+    auto later = source.clone();
+    held->parameters[".step"].value = "0.5";
+    found->value = "20.0";
+    assert(later->getSection("search")->getParameter(".step") == nullptr &&
+           later->getValueByPath("/search/.max_magnitude") == "17.0" &&
+           "Earlier pointers should not write into a later clone");
+    assert(source.getValueByPath("/search/.max_magnitude") == "20.0");
+    
+    return true;
+}
+
 /**
  * @brief Test isEmpty functionality
  */
@@ -304,6 +374,296 @@ bool testGetParametersByType() {
     return true;
 }
 
+/**
+ * @brief Test compiled patterns, pattern cache and non-copying results
+ */
+bool testCompiledPatterns() {
+    OopParser parser;
+    parser.setParameter("object", ".magnitude", "16.5");
+    parser.setParameter("search", ".max_magnitude", "17.0");
+    parser.setParameter("search", "name", "Asteroid");
+    
+    CompiledPattern magnitude("MAGNITUDE$");
+    assert(magnitude.isValid() && magnitude.matches(".max_magnitude") && !magnitude.matches("name"));
+    
+    auto found = parser.findParametersByKeyPattern(magnitude);
+    assert(found.size() == 2);
+    assert(found[0] == parser.getSection("object")->getParameter(".magnitude") && "Should point into parser");
+    
+    size_t visited = parser.forEachParameterByValuePattern(CompiledPattern("^aster"),
+        [](const ConfigSectionData& section, const ConfigParameter& param) {
+            assert(section.name == "search" && param.key == "name");
+        });
+    assert(visited == 1);
+    
+    // Cache returns the same compiled object and evicts least recently used
+    parser.setPatternCacheCapacity(2);
+    auto first = parser.getCompiledPattern("a");
+    assert(parser.getCompiledPattern("a") == first);
+    parser.getCompiledPattern("b");
+    parser.getCompiledPattern("a");
+    parser.getCompiledPattern("c");
+    assert(parser.getCompiledPattern("a") == first && "Recently used pattern should survive");
+    assert(parser.findParametersByValuePattern("^1[67]").size() == 2);
+    
+    // Invalid patterns report an error instead of throwing
+    CompiledPattern broken("([");
+    assert(!broken.isValid() && !broken.getError().empty() && !broken.matches("(["));
+    assert(parser.findParametersByKeyPattern("([").empty() && !parser.getLastError().empty());
+    
+    return true;
+}
+
+/**
+ * @brief Test fast pattern kinds agree with std::regex
+ */
+bool testFastPatterns() {
+    using Kind = CompiledPattern::Kind;
+    assert(CompiledPattern("steroid").getKind() == Kind::LITERAL);
+    assert(CompiledPattern(".*magnitude.*").getKind() == Kind::LITERAL);
+    assert(CompiledPattern("^obj").getKind() == Kind::PREFIX);
+    assert(CompiledPattern(".*tude$").getKind() == Kind::SUFFIX);
+    assert(CompiledPattern("^\\.name$").getKind() == Kind::EXACT);
+    assert(CompiledPattern("^obj.*mag").getKind() == Kind::GLOB);
+    assert(CompiledPattern("[0-9]+").getKind() == Kind::REGEX);
+    assert(CompiledPattern("a\\d").getKind() == Kind::REGEX);
+    assert(CompiledPattern("a\\$").getKind() == Kind::LITERAL);
+    
+    const std::vector<std::string> patterns = {
+        "", "steroid", ".*magnitude.*", "^obj", "^OBJ", ".*tude$", "^\\.name$", "^obj.*mag",
+        "a.*b.*c", "^a.*b$", "ma.*.*de", "a\\$", "\\.max", "1\\.5$", ".*", "^.*$", "^$"
+    };
+    const std::vector<std::string> texts = {
+        "", "Asteroid", ".max_magnitude", "object", "OBJECT_mag", ".name", "x.name",
+        "abc", "aXbYc", "cba", "ab", "a$", "1.5", "2.5e1", "a\nb", "obj\nmag", "MAGnitude"
+    };
+    for (const auto& pattern : patterns) {
+        CompiledPattern compiled(pattern);
+        std::regex reference(pattern, std::regex::icase);
+        for (const auto& text : texts) {
+            assert(compiled.matches(text) == std::regex_search(text, reference) &&
+                   "Fast matcher should agree with std::regex");
+        }
+    }
+    
+    return true;
+}
+
+/**
+ * @brief Test type index stays in sync with modifications
+ */
+bool testTypeIndex() {
+    OopParser parser;
+    parser.setParameter("object", "id", "17030");
+    parser.setParameter("object", "name", "Apophis");
+    parser.setParameter("search", ".max_magnitude", "17.0");
+    parser.setParameter("search", ".min_magnitude", "12.5");
+    
+    assert(parser.getParameterCountByType("float") == 2);
+    assert(parser.findParametersByType("float")[0] == parser.getSection("search")->getParameter(".max_magnitude"));
+    
+    // Updates through every kind of mutation are reflected
+    auto snapshot = parser.clone();
+    parser.setParameter("object", "id", "17030.5");
+    assert(parser.getParameterCountByType("int") == 0 && parser.getParameterCountByType("float") == 3);
+    
+    PathHandle name("/object/name");
+    parser.setValueByPath(name, ".TRUE.");
+    assert(parser.getParameterCountByType("bool") == 1);
+    
+    parser.deleteByPath("/search/.min_magnitude");
+    OopParser other;
+    other.setParameter("propag", "step", "5");
+    parser.merge(other);
+    parser.getSection("propag")->getParameter("step")->type = "string";
+    
+    auto counts = parser.getParameterCountsByType();
+    assert(counts.size() == 3 && counts["float"] == 2 && counts["bool"] == 1 && counts["string"] == 1);
+    assert(parser.getParametersByType("string")[0].key == "step");
+    
+    parser.deleteByPath("/propag");
+    assert(parser.getParameterCountByType("string") == 0);
+    
+    // Erasing through a pointer held across a query leaves nothing dangling
+    ConfigSectionData* search = parser.getSection("search");
+    assert(parser.findParametersByType("float").size() == 2);
+    search->parameters.erase(".max_magnitude");
+    assert(parser.findParametersByType("float").size() == 1 && parser.getParametersByType("float")[0].key == "id");
+    assert(parser.queryParameters("type = float").size() == 1);
+    
+    // The snapshot keeps its own view
+    assert(snapshot->getParameterCountByType("int") == 1 && snapshot->getParameterCountByType("float") == 2);
+    
+    parser.clear();
+    assert(parser.getParameterCountsByType().empty() && parser.findParametersByType("float").empty());
+    
+    // Results follow section order, also after sections move
+    for (const char* name : {"a", "b", "c", "d"}) {
+        parser.setParameter(name, "x", std::string(name) == "b" || std::string(name) == "d" ? "1.5" : "1");
+    }
+    assert(parser.getParametersByType("float").size() == 2);
+    parser.deleteByPath("/b");
+    parser.setParameter("b", "x", "2.5");
+    auto floats = parser.findParametersByType("float");
+    assert(floats.size() == 2 && floats[0]->value == "1.5" && floats[1]->value == "2.5");
+    assert(parser.queryParameters("type = float").size() == 2);
+    
+    return true;
+}
+
+/**
+ * @brief Test non-copying visitors and section views
+ */
+bool testVisitors() {
+    OopParser parser;
+    parser.setParameter("object", "id", "17030");
+    parser.setParameter("object", ".magnitude", "16.5");
+    parser.setParameter("search", ".max_magnitude", "17.0");
+    
+    std::vector<const ConfigParameter*> seen;
+    size_t matches = parser.forEachParameterWhere(
+        [](const ConfigParameter& p) { return p.type == "float"; },
+        [&seen](const ConfigSectionData&, const ConfigParameter& p) { seen.push_back(&p); });
+    assert(matches == 2 && seen.size() == 2);
+    assert(seen[0] == parser.getSection("object")->getParameter(".magnitude") && "Should not copy");
+    
+    size_t sections = parser.forEachSectionWhere(
+        [](const ConfigSectionData& s) { return s.parameters.size() > 1; },
+        [](const ConfigSectionData& s) { assert(s.name == "object"); });
+    assert(sections == 1);
+    
+    std::vector<std::string> names;
+    parser.forEachSection([&names](const ConfigSectionData& s) { names.push_back(s.name); });
+    assert((names == std::vector<std::string>{"object", "search"}));
+    
+    {
+        auto view = parser.viewSections();
+        assert(view.size() == 2 && !view.empty() && view[1].name == "search");
+        size_t params = 0;
+        for (const ConfigSectionData& section : view) {
+            params += section.parameters.size();
+        }
+        assert(params == 3);
+    }
+    
+    // The view released the lock, and saveToStream writes the same content
+    parser.setParameter("search", "flag", ".TRUE.");
+    std::ostringstream out;
+    assert(parser.saveToStream(out));
+    assert(out.str() == "[object]\n.magnitude = 16.5\nid = 17030\n\n[search]\n.max_magnitude = 17.0\nflag = .TRUE.\n");
+    
+    return true;
+}
+
+/**
+ * @brief Test parallel predicate queries match serial ones
+ */
+bool testParallelQueries() {
+    OopParser parser;
+    for (int s = 0; s < 37; ++s) {
+        for (int p = 0; p < (s % 5) * 40 + 1; ++p) {
+            parser.setParameter("section_" + std::to_string(s), "param_" + std::to_string(p),
+                                std::to_string(s * 1000 + p));
+        }
+    }
+    
+    auto divisible = [](const ConfigParameter& param) { return std::stoi(param.value) % 7 == 0; };
+    auto serial = parser.getParametersWhere(std::function<bool(const ConfigParameter&)>(divisible));
+    assert(!serial.empty());
+    assert(parser.getParametersWhere(divisible).size() == serial.size() && "Lambda overload should agree");
+    
+    for (size_t threads : {0, 1, 3, 64}) {
+        auto parallel = parser.getParametersWhereParallel(divisible, threads);
+        assert(parallel.size() == serial.size());
+        for (size_t i = 0; i < serial.size(); ++i) {
+            assert(parallel[i].key == serial[i].key && parallel[i].value == serial[i].value &&
+                   "Parallel results should keep section/key order");
+        }
+        
+        auto late = [](const ConfigParameter& param) { return std::stoi(param.value) >= 30000; };
+        const OopParser& view = parser;
+        assert(view.findWhereParallel(late, threads) == view.findWhere(late));
+        assert(view.findWhereParallel([](const ConfigParameter&) { return false; }, threads) == nullptr);
+    }
+    
+    // Queries from inside a pooled task run on the same shared pool without waiting on it
+    OopParser other;
+    other.setParameter("a", "x", "7");
+    other.setParameter("b", "y", "14");
+    std::atomic<size_t> nested{0};
+    parser.getParametersWhereParallel([&](const ConfigParameter& param) {
+        if (param.key == "param_0") {
+            nested += other.getParametersWhereParallel(divisible, 2).size();
+        }
+        return false;
+    }, 8);
+    assert(nested == 37 * 2);
+    
+    // Non-const lambda overload still returns a writable parameter
+    ConfigParameter* id = parser.findWhere([](const ConfigParameter& param) { return param.value == "3007"; });
+    assert(id && id->key == "param_7");
+    
+    bool thrown = false;
+    try {
+        parser.getParametersWhereParallel([](const ConfigParameter& param) -> bool {
+            if (param.value == "36000") {
+                throw std::runtime_error("bad parameter");
+            }
+            return false;
+        }, 4);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown && "Worker exceptions should reach the caller");
+    
+    return true;
+}
+
+/**
+ * @brief Test query expressions
+ */
+bool testQueryLanguage() {
+    OopParser parser;
+    parser.setParameter("propag", "step", "0.01");
+    parser.setParameter("propag", "dt", "1.0D-2");
+    parser.setParameter("propag", "tolerance", "1.0e-12");
+    parser.setParameter("propag", "order", "12");
+    parser.setParameter("search", "tolerance", "1.0e-6");
+    parser.setParameter("search", "name", "'Apophis'");
+    
+    auto keys = [&parser](const std::string& expression) {
+        std::vector<std::string> result;
+        for (const ConfigParameter* param : parser.queryParameters(expression)) {
+            result.push_back(param->key);
+        }
+        return result;
+    };
+    
+    assert((keys("section=propag AND type=float AND value>1e-10") == std::vector<std::string>{"step"}));
+    assert((keys("key=tolerance AND value <= 1E-6") == std::vector<std::string>{"tolerance", "tolerance"}));
+    assert((keys("type = int OR value ~ 'apo'") == std::vector<std::string>{"order", "name"}));
+    assert((keys("NOT (section=propag) AND key != name") == std::vector<std::string>{"tolerance"}));
+    assert((keys("value = 1e-2") == std::vector<std::string>{"dt", "step"}) && "Numbers should compare numerically");
+    assert(keys("value > 5 AND type=string").empty() && "Ordering should skip non-numeric values");
+    assert(keys("section=propag AND section=search").empty());
+    
+    ConfigQuery query("section=search and key~'^tol'");
+    assert(query.isValid() && query.getExpression() == "section=search and key~'^tol'");
+    size_t count = parser.queryParameters(query, [](const ConfigSectionData& section, const ConfigParameter& param) {
+        assert(section.name == "search" && param.key == "tolerance");
+    });
+    assert(count == 1);
+    
+    // Syntax errors are reported, not thrown
+    for (const char* bad : {"section", "section = ", "size=3", "key=a AND", "(key=a", "value ~ '(['", "key='a"}) {
+        ConfigQuery broken(bad);
+        assert(!broken.isValid() && !broken.getError().empty());
+    }
+    assert(parser.queryParameters("value >> 3").empty() && !parser.getLastError().empty());
+    
+    return true;
+}
+
 /**
  * @brief Run all tests
  */
@@ -361,6 +721,15 @@ int main() {
         failed++;
     }
     
+    std::cout << "Test: applyDiff functionality... ";
+    if (testApplyDiff()) {
+        std::cout << "PASS\n";
+        passed++;
+    } else {
+        std::cout << "FAIL\n";
+        failed++;
+    }
+    
     // Clone tests
     std::cout << "Test: Clone functionality... ";
     if (testClone()) {
@@ -380,6 +749,15 @@ int main() {
         failed++;
     }
     
+    std::cout << "Test: Copy-on-write sharing... ";
+    if (testCopyOnWrite()) {
+        std::cout << "PASS\n";
+        passed++;
+    } else {
+        std::cout << "FAIL\n";
+        failed++;
+    }
+    
     std::cout << "Test: isEmpty functionality... ";
     if (testIsEmpty()) {
         std::cout << "PASS\n";
@@ -426,6 +804,60 @@ int main() {
         failed++;
     }
     
+    std::cout << "Test: Compiled patterns... ";
+    if (testCompiledPatterns()) {
+        std::cout << "PASS\n";
+        passed++;
+    } else {
+        std::cout << "FAIL\n";
+        failed++;
+    }
+    
+    std::cout << "Test: Fast pattern matching... ";
+    if (testFastPatterns()) {
+        std::cout << "PASS\n";
+        passed++;
+    } else {
+        std::cout << "FAIL\n";
+        failed++;
+    }
+    
+    std::cout << "Test: Type index... ";
+    if (testTypeIndex()) {
+        std::cout << "PASS\n";
+        passed++;
+    } else {
+        std::cout << "FAIL\n";
+        failed++;
+    }
+    
+    std::cout << "Test: Non-copying visitors... ";
+    if (testVisitors()) {
+        std::cout << "PASS\n";
+        passed++;
+    } else {
+        std::cout << "FAIL\n";
+        failed++;
+    }
+    
+    std::cout << "Test: Parallel predicate queries... ";
+    if (testParallelQueries()) {
+        std::cout << "PASS\n";
+        passed++;
+    } else {
+        std::cout << "FAIL\n";
+        failed++;
+    }
+    
+    std::cout << "Test: Query language... ";
+    if (testQueryLanguage()) {
+        std::cout << "PASS\n";
+        passed++;
+    } else {
+        std::cout << "FAIL\n";
+        failed++;
+    }
+    
     std::cout << "\n" << std::string(50, '=') << "\n";
     std::cout << "Results: " << passed << " passed, " << failed << " failed\n";
     
@@ -9,6 +9,7 @@
  * - deleteByPath()
  * - getAllPaths()
  * - Path parsing and escaping
+ * - Compiled PathHandle access
  * 
  * @author Michele Bigi
  * @date 2025-12-02
@@ -17,6 +18,8 @@
 #include "ioc_config/oop_parser.h"
 #include <iostream>
 #include <cassert>
+#include <map>
+#include <vector>
 
 using namespace ioc_config;
 
@@ -260,6 +263,196 @@ bool testSectionPath() {
     return true;
 }
 
+/**
+ * @brief Test compiled path handles follow layout changes
+ */
+bool testPathHandle() {
+    OopParser parser;
+    parser.setParameter("object", "id", "17030");
+    parser.setParameter("search", ".max_magnitude", "17.0");
+    
+    const PathHandle id("/object/id");
+    const PathHandle missing("/object/name");
+    assert(id.isParameterPath() && id.getComponents().size() == 2);
+    assert(parser.getValueByPath(id) == "17030" && "Handle should resolve parameter");
+    assert(parser.getValueByPath(missing).empty() && "Missing parameter should be empty");
+    
+    // In-place update, then structural changes that move or drop the slot
+    assert(parser.setValueByPath(id, "99942"));
+    assert(parser.getValueByPath("/object/id") == "99942" && "Set through handle should be visible");
+    assert(parser.getSection("object")->getParameter("id")->type == "int");
+    
+    parser.setParameter("object", "name", "Apophis");
+    assert(parser.getValueByPath(missing) == "Apophis" && "Handle should see new parameter");
+    
+    auto snapshot = parser.clone();
+    assert(parser.setValueByPath(id, "1"));
+    assert(snapshot->getValueByPath(id) == "99942" && "Shared section should be copied before write");
+    assert(parser.getValueByPath(id) == "1");
+    
+    parser.deleteByPath("/object");
+    assert(parser.getValueByPath(id).empty() && "Handle should not see deleted section");
+    assert(parser.setValueByPath(id, "2") && parser.getValueByPath(id) == "2");
+    
+    // Erasing through a section pointer obtained earlier is seen at once
+    ConfigSectionData* object = parser.getSection("object");
+    assert(parser.getValueByPath(id) == "2");
+    object->parameters.erase("id");
+    assert(parser.getValueByPath(id).empty() && "Handle should not return an erased parameter");
+    object->name = "renamed";
+    assert(parser.getValueByPath(missing).empty() && "Handle should not follow a renamed section");
+    
+    // One handle across several parsers (each keeps its own resolution)
+    std::vector<OopParser> asteroids(3);
+    for (size_t i = 0; i < asteroids.size(); ++i) {
+        asteroids[i].setParameter("other", "x", "-");
+        asteroids[i].setParameter("object", "id", std::to_string(i));
+    }
+    for (int round = 0; round < 2; ++round) {
+        for (size_t i = 0; i < asteroids.size(); ++i) {
+            assert(asteroids[i].getValueByPath(id) == std::to_string(i));
+        }
+    }
+    
+    // Section handles fall back to string access
+    assert(parser.getValueByPath(PathHandle("/object")) == parser.getValueByPath("/object"));
+    assert(!parser.setValueByPath(PathHandle("/object"), "x"));
+    
+    return true;
+}
+
+/**
+ * @brief Test existence checks and typed getters
+ */
+bool testTypedGetters() {
+    OopParser parser;
+    parser.setParameter("propag", "step", "1.0D-2");
+    parser.setParameter("propag", "order", " 12 ");
+    parser.setParameter("propag", "enabled", ".TRUE.");
+    parser.setParameter("propag", "comment", "");
+    parser.setParameter("search", "flag", "no");
+    parser.getSection("search")->parameters.clear();
+    
+    // Existence does not depend on the value being non-empty
+    assert(parser.hasPath("/propag/comment") && "Empty value should exist");
+    assert(parser.hasPath("/search") && "Empty section should exist");
+    assert(parser.hasPath("/") && parser.hasPath(""));
+    assert(!parser.hasPath("/search/flag") && !parser.hasPath("/missing"));
+    assert(!parser.hasPath("propag/step") && "Relative path should not exist");
+    
+    double step = 0;
+    int order = 0;
+    bool enabled = false;
+    assert(parser.getDoubleByPath("/propag/step", step) && step == 0.01);
+    assert(parser.getIntByPath("/propag/order", order) && order == 12);
+    assert(parser.getBoolByPath("/propag/enabled", enabled) && enabled);
+    assert(parser.getDoubleByPath(PathHandle("/propag/order"), step) && step == 12.0);
+    
+    // Failed conversions leave the output untouched
+    assert(!parser.getIntByPath("/propag/step", order) && order == 12);
+    assert(!parser.getBoolByPath("/propag/order", enabled) && enabled);
+    assert(!parser.getDoubleByPath("/propag/comment", step));
+    assert(!parser.getDoubleByPath("/propag", step) && !parser.getIntByPath("/propag/missing", order));
+    
+    // Serialization is explicit
+    assert(parser.dumpByPath("/search") == "{}");
+    assert(parser.dumpByPath("/propag/order") == " 12 ");
+    assert(parser.dumpByPath("/") == parser.getValueByPath("/"));
+    
+    return true;
+}
+
+/**
+ * @brief Test batched multi-path get/set
+ */
+bool testBatchedPaths() {
+    OopParser parser;
+    parser.setParameter("object", "id", "17030");
+    parser.setParameter("search", "max", "17.0");
+    
+    auto snapshot = parser.clone();
+    std::vector<std::pair<std::string, std::string>> batch = {
+        {"/search/max", "18.5"},
+        {"/object/id", "99942"},
+        {"/object", "x"},
+        {"/propag/step", "0.1"},
+        {"/object/id", "1"},
+        {"/search/min", "2"}
+    };
+    auto status = parser.setValuesByPaths(batch);
+    assert(status.size() == 6);
+    assert(status[0] == PathStatus::OK && status[1] == PathStatus::OK);
+    assert(status[2] == PathStatus::INVALID_PATH && "Section path cannot be set");
+    assert(status[3] == PathStatus::CREATED && status[5] == PathStatus::CREATED);
+    assert(parser.getValueByPath("/object/id") == "1" && "Later duplicate should win");
+    assert(parser.getSection("search")->getParameter("max")->type == "float");
+    assert(snapshot->getValueByPath("/search/max") == "17.0" && "Shared sections should be copied");
+    
+    auto results = parser.getValuesByPaths({"/propag/step", "/object/name", "/nope/x", "/", "/search/max"});
+    assert(results.size() == 5);
+    assert(results[0].status == PathStatus::OK && results[0].value == "0.1");
+    assert(results[1].status == PathStatus::NOT_FOUND && results[2].status == PathStatus::NOT_FOUND);
+    assert(results[3].status == PathStatus::INVALID_PATH);
+    assert(results[4].status == PathStatus::OK && results[4].value == "18.5");
+    
+    // Map overload and compiled handles see the batch changes
+    PathHandle step("/propag/step");
+    assert(parser.getValueByPath(step) == "0.1");
+    std::map<std::string, std::string> updates = {{"/propag/step", "0.2"}, {"/propag/order", "12"}};
+    status = parser.setValuesByPaths(updates);
+    assert(status[0] == PathStatus::CREATED && status[1] == PathStatus::OK);
+    assert(parser.getValueByPath(step) == "0.2");
+    
+    return true;
+}
+
+/**
+ * @brief Test glob path queries
+ */
+bool testGlobQueries() {
+    OopParser parser;
+    parser.setParameter("asteroids", "a1", "433");
+    parser.setParameter("asteroids", "a2", "1036");
+    parser.setParameter("asteroids", "b1", "99942");
+    parser.setParameter("propag", "tolerance", "1e-12");
+    parser.setParameter("propag", ".step", "0.1");
+    parser.setParameter("search", "tolerance", "1e-6");
+    parser.setParameter("a/b", "x~y", "1");
+    
+    auto collect = [&parser](const std::string& pattern) {
+        std::vector<std::string> paths;
+        parser.findPaths(pattern, [&paths](const std::string& path, const ConfigSectionData&,
+                                           const ConfigParameter*) {
+            paths.push_back(path);
+            return true;
+        });
+        return paths;
+    };
+    
+    assert(collect("/asteroids/*").size() == 3);
+    assert((collect("/asteroids/a[0-9]") == std::vector<std::string>{"/asteroids/a1", "/asteroids/a2"}));
+    assert((collect("/asteroids/[!a]?") == std::vector<std::string>{"/asteroids/b1"}));
+    assert((collect("/*/tolerance") == std::vector<std::string>{"/propag/tolerance", "/search/tolerance"}));
+    assert((collect("/**/.st*") == std::vector<std::string>{"/propag/.step"}));
+    assert((collect("/*") == std::vector<std::string>{"/asteroids", "/propag", "/search", "/a~1b"}));
+    assert(collect("/**").size() == 4 + 7 && "Double star should match sections and parameters");
+    assert((collect("/a~1b/x~0*") == std::vector<std::string>{"/a~1b/x~0y"}) && "Escapes should round-trip");
+    assert(collect("/asteroids/c*").empty() && collect("/").empty());
+    assert((collect("/propag") == std::vector<std::string>{"/propag"}) && collect("/Propag/*").empty());
+    assert((collect("/propag/**") == std::vector<std::string>{"/propag", "/propag/.step", "/propag/tolerance"}));
+    
+    // Section and parameter are passed through; false stops the stream
+    size_t seen = 0;
+    size_t delivered = parser.findPaths("/**", [&seen](const std::string&, const ConfigSectionData& section,
+                                                       const ConfigParameter* param) {
+        assert(param == nullptr || section.getParameter(param->key) == param);
+        return ++seen < 2;
+    });
+    assert(seen == 2 && delivered == 2);
+    
+    return true;
+}
+
 /**
  * @brief Run all tests
  */
@@ -360,6 +553,42 @@ int main() {
         failed++;
     }
     
+    std::cout << "Test: Compiled path handles... ";
+    if (testPathHandle()) {
+        std::cout << "PASS\n";
+        passed++;
+    } else {
+        std::cout << "FAIL\n";
+        failed++;
+    }
+    
+    std::cout << "Test: Existence checks and typed getters... ";
+    if (testTypedGetters()) {
+        std::cout << "PASS\n";
+        passed++;
+    } else {
+        std::cout << "FAIL\n";
+        failed++;
+    }
+    
+    std::cout << "Test: Batched path get/set... ";
+    if (testBatchedPaths()) {
+        std::cout << "PASS\n";
+        passed++;
+    } else {
+        std::cout << "FAIL\n";
+        failed++;
+    }
+    
+    std::cout << "Test: Glob path queries... ";
+    if (testGlobQueries()) {
+        std::cout << "PASS\n";
+        passed++;
+    } else {
+        std::cout << "FAIL\n";
+        failed++;
+    }
+    
     std::cout << "\n" << std::string(50, '=') << "\n";
     std::cout << "Results: " << passed << " passed, " << failed << " failed\n";
     
@@ -4,6 +4,8 @@
  */
 #include <cassert>
 #include <iostream>
+#include <fstream>
+#include <filesystem>
 #include "../include/ioc_config/oop_parser.h"
 
 using namespace ioc_config;
@@ -179,6 +181,424 @@ int main() {
         std::cout << "PASS" << std::endl; ++passCount;
     } catch (const std::exception& e) { std::cout << "FAIL: " << e.what() << std::endl; }
     
+    // Test 13: Delta mode rollback
+    try {
+        ++testCount;
+        std::cout << "Test " << testCount << ": Delta mode rollback ... ";
+        VersionedOopParser p;
+        assert(p.setStorageMode(VersionStorageMode::DELTA, 4));
+        p.setParameter("s", "p", "v1");
+        p.setParameter("s", "q", "keep");
+        p.enableVersioning("V1");
+        for (int i = 2; i <= 10; ++i) {
+            p.setParameter("s", "p", "v" + std::to_string(i));
+            if (i == 5) p.deleteByPath("/s/q");
+            if (i == 7) p.setParameter("t", "r", "new");
+            p.createVersion("V" + std::to_string(i));
+        }
+        assert(p.getVersionCount() == 10);
+        assert(p.getVersion(5)->is_keyframe);
+        assert(!p.getVersion(6)->is_keyframe);
+        assert(p.getVersion(6)->snapshot == nullptr);
+        for (size_t v = 10; v >= 1; --v) {
+            assert(p.rollback(v));
+            assert(p.findParameter("p")->value == "v" + std::to_string(v));
+            assert((p.findParameter("q") != nullptr) == (v < 5));
+            assert((p.getSection("t") != nullptr) == (v >= 7));
+        }
+        std::cout << "PASS" << std::endl; ++passCount;
+    } catch (const std::exception& e) { std::cout << "FAIL: " << e.what() << std::endl; }
+    
+    // Test 14: Delta mode memory and snapshots
+    try {
+        ++testCount;
+        std::cout << "Test " << testCount << ": Delta mode memory ... ";
+        VersionedOopParser full, delta;
+        delta.setStorageMode(VersionStorageMode::DELTA);
+        for (int i = 0; i < 200; ++i) {
+            full.setParameter("s", "k" + std::to_string(i), "some reasonably long value " + std::to_string(i));
+            delta.setParameter("s", "k" + std::to_string(i), "some reasonably long value " + std::to_string(i));
+        }
+        full.enableVersioning("V1");
+        delta.enableVersioning("V1");
+        for (int i = 0; i < 20; ++i) {
+            full.setParameter("s", "k0", std::to_string(i));
+            delta.setParameter("s", "k0", std::to_string(i));
+            full.createVersion();
+            delta.createVersion();
+        }
+        assert(delta.getHistoryMemoryUsage() * 4 < full.getHistoryMemoryUsage());
+        auto snap = delta.getVersionSnapshot(7);
+        assert(snap != nullptr);
+        assert(snap->findParameter("k0")->value == "5");
+        assert(delta.getVersionSnapshot(99) == nullptr);
+        assert(!delta.setStorageMode(VersionStorageMode::DELTA, 0));
+        std::cout << "PASS" << std::endl; ++passCount;
+    } catch (const std::exception& e) { std::cout << "FAIL: " << e.what() << std::endl; }
+    
+    // Test 15: Full snapshots share unchanged sections
+    try {
+        ++testCount;
+        std::cout << "Test " << testCount << ": Structural sharing ... ";
+        VersionedOopParser parser;
+        for (int s = 0; s < 20; ++s) {
+            for (int i = 0; i < 50; ++i) {
+                parser.setParameter("s" + std::to_string(s), "k" + std::to_string(i),
+                                    "some reasonably long value " + std::to_string(i));
+            }
+        }
+        parser.enableVersioning("V1");
+        size_t config_bytes = parser.getMemoryUsage();
+        for (int v = 0; v < 1000; ++v) {
+            parser.setParameter("s" + std::to_string(v % 20), "k0", std::to_string(v));
+            parser.createVersion();
+        }
+        // Each version only copies the one section that changed
+        assert(parser.getHistoryMemoryUsage() < config_bytes * 100);
+        assert(parser.rollback(501));
+        assert(parser.getValueByPath("/s19/k0") == "499");
+        assert(parser.getValueByPath("/s0/k0") == "480");
+        std::cout << "PASS" << std::endl; ++passCount;
+    } catch (const std::exception& e) { std::cout << "FAIL: " << e.what() << std::endl; }
+    
+    // Test 16: Bounded history by version count
+    try {
+        ++testCount;
+        std::cout << "Test " << testCount << ": History version limit ... ";
+        VersionedOopParser parser;
+        parser.setStorageMode(VersionStorageMode::DELTA, 3);
+        parser.setHistoryLimits(5);
+        parser.setParameter("s", "k", "0");
+        parser.enableVersioning("V1");
+        for (int i = 1; i < 20; ++i) {
+            parser.setParameter("s", "k", std::to_string(i));
+            parser.createVersion("Step " + std::to_string(i));
+        }
+        assert(parser.getVersionCount() == 5);
+        assert(parser.getOldestVersion() == 16);
+        assert(parser.getVersion(15) == nullptr);
+        assert(parser.getVersion(16)->is_keyframe);
+        assert(parser.getVersion(18)->description == "Step 17");
+        std::vector<size_t> seen;
+        parser.forEachVersion([&seen](const VersionEntry& entry) { seen.push_back(entry.version); });
+        assert((seen == std::vector<size_t>{16, 17, 18, 19, 20}));
+        assert(!parser.rollback(15));
+        assert(parser.rollback(17));
+        assert(parser.getValueByPath("/s/k") == "16");
+        parser.setHistoryLimits(2);
+        assert(parser.getOldestVersion() == 19);
+        std::cout << "PASS" << std::endl; ++passCount;
+    } catch (const std::exception& e) { std::cout << "FAIL: " << e.what() << std::endl; }
+    
+    // Test 17: Bounded history by size
+    try {
+        ++testCount;
+        std::cout << "Test " << testCount << ": History byte limit ... ";
+        VersionedOopParser parser;
+        for (int i = 0; i < 100; ++i) {
+            parser.setParameter("s" + std::to_string(i % 10), "k" + std::to_string(i),
+                                "some reasonably long value " + std::to_string(i));
+        }
+        parser.enableVersioning("V1");
+        size_t limit = parser.getHistoryMemoryUsage() * 3;
+        parser.setHistoryLimits(0, limit);
+        for (int v = 0; v < 200; ++v) {
+            parser.setParameter("s" + std::to_string(v % 10), "k0", std::to_string(v));
+            parser.createVersion();
+        }
+        assert(parser.getVersionCount() < 200);
+        assert(parser.getCurrentVersion() == 201);
+        assert(parser.getHistoryMemoryUsage() <= limit);
+        assert(parser.getMaxHistoryBytes() == limit && parser.getMaxVersions() == 0);
+        std::cout << "PASS" << std::endl; ++passCount;
+    } catch (const std::exception& e) { std::cout << "FAIL: " << e.what() << std::endl; }
+    
+    // Test 18: Journal recovery
+    try {
+        ++testCount;
+        std::cout << "Test " << testCount << ": Journal recovery ... ";
+        const std::string path = "./test_versioning.journal";
+        std::filesystem::remove(path);
+        JournalOptions options;
+        options.checkpoint_interval = 4;
+        {
+            VersionedOopParser parser;
+            parser.setStorageMode(VersionStorageMode::DELTA, 3);
+            assert(parser.attachJournal(path, options));
+            assert(!parser.isVersioningEnabled());
+            parser.setParameter("object", "id", "17030");
+            parser.setParameter("object", ".mag", "16.5");
+            parser.enableVersioning("V1");
+            for (int i = 2; i <= 10; ++i) {
+                parser.setParameter("search", "step", std::to_string(i));
+                if (i == 6) {
+                    parser.deleteByPath("/object/.mag");
+                }
+                parser.createVersion("Step " + std::to_string(i));
+            }
+        }
+        // Simulate a crash in the middle of a write
+        {
+            std::ofstream out(path, std::ios::app);
+            out << "{\"op\":\"delta\",\"vers";
+        }
+        size_t torn_size = std::filesystem::file_size(path);
+        
+        VersionedOopParser recovered;
+        assert(recovered.attachJournal(path, options));
+        assert(std::filesystem::file_size(path) < torn_size);
+        assert(recovered.isVersioningEnabled());
+        assert(recovered.getVersionCount() == 10);
+        assert(recovered.getCurrentVersion() == 10);
+        assert(recovered.getVersionDescription(7) == "Step 7");
+        assert(recovered.getValueByPath("/search/step") == "10");
+        assert(recovered.getSection("object")->getParameter(".mag") == nullptr);
+        assert(recovered.rollback(4));
+        assert(recovered.getValueByPath("/object/.mag") == "16.5");
+        assert(recovered.getSection("object")->getParameter(".mag")->type == "float");
+        
+        // New versions continue the recovered history
+        recovered.setParameter("search", "step", "11");
+        recovered.createVersion("Step 11");
+        recovered.detachJournal();
+        VersionedOopParser again;
+        assert(again.attachJournal(path, options));
+        assert(again.getCurrentVersion() == 11);
+        assert(again.getValueByPath("/search/step") == "11");
+        again.detachJournal();
+        std::filesystem::remove(path);
+        std::cout << "PASS" << std::endl; ++passCount;
+    } catch (const std::exception& e) { std::cout << "FAIL: " << e.what() << std::endl; }
+    
+    // Test 19: Journal compaction
+    try {
+        ++testCount;
+        std::cout << "Test " << testCount << ": Journal compaction ... ";
+        const std::string path = "./test_versioning_compact.journal";
+        std::filesystem::remove(path);
+        VersionedOopParser parser;
+        for (int i = 0; i < 50; ++i) {
+            parser.setParameter("s", "k" + std::to_string(i), "value " + std::to_string(i));
+        }
+        parser.enableVersioning("V1");
+        parser.setHistoryLimits(5);
+        JournalOptions options;
+        options.sync_mode = JournalSyncMode::NONE;
+        options.checkpoint_interval = 8;
+        assert(parser.attachJournal(path, options));
+        for (int v = 2; v <= 40; ++v) {
+            parser.setParameter("s", "k0", std::to_string(v));
+            parser.createVersion();
+        }
+        size_t before = parser.getJournalSize();
+        assert(parser.startJournalCompaction());
+        parser.setParameter("s", "k0", "41");
+        parser.createVersion("During compaction");
+        assert(parser.waitForJournalCompaction());
+        assert(parser.getJournalSize() < before);
+        assert(parser.getJournalSize() == std::filesystem::file_size(path));
+        parser.detachJournal();
+        
+        VersionedOopParser recovered;
+        recovered.setHistoryLimits(5);
+        assert(recovered.attachJournal(path, options));
+        assert(recovered.getOldestVersion() == 37);
+        assert(recovered.getCurrentVersion() == 41);
+        assert(recovered.getVersionDescription(41) == "During compaction");
+        assert(recovered.rollback(38));
+        assert(recovered.getValueByPath("/s/k0") == "38");
+        
+        // clearHistory starts a new history in the journal
+        assert(recovered.clearHistory());
+        recovered.detachJournal();
+        VersionedOopParser reset;
+        assert(reset.attachJournal(path, options));
+        assert(reset.getVersionCount() == 1 && reset.getCurrentVersion() == 1);
+        assert(reset.getValueByPath("/s/k0") == "38");
+        reset.detachJournal();
+        std::filesystem::remove(path);
+        std::cout << "PASS" << std::endl; ++passCount;
+    } catch (const std::exception& e) { std::cout << "FAIL: " << e.what() << std::endl; }
+    
+    // Test 20: Composed version diffs match snapshot diffs
+    try {
+        ++testCount;
+        std::cout << "Test " << testCount << ": Composed version diff ... ";
+        for (auto mode : {VersionStorageMode::FULL_SNAPSHOT, VersionStorageMode::DELTA}) {
+            VersionedOopParser parser;
+            parser.setStorageMode(mode, 3);
+            for (int i = 0; i < 20; ++i) {
+                parser.setParameter("s", "k" + std::to_string(i), std::to_string(i));
+            }
+            parser.enableVersioning("V1");
+            parser.setParameter("s", "k0", "changed");                // v2
+            parser.createVersion();
+            parser.deleteByPath("/s/k1");                             // v3
+            parser.setParameter("t", "new", "1.5");
+            parser.createVersion();
+            parser.setParameter("s", "k0", "0");                      // v4: k0 back to original
+            parser.setParameter("t", "new", "2.5");
+            parser.createVersion();
+            parser.deleteByPath("/t/new");                            // v5: added then removed
+            parser.createVersion();
+            
+            for (size_t a = 1; a <= 5; ++a) {
+                for (size_t b = 1; b <= 5; ++b) {
+                    auto composed = parser.getVersionDiff(a, b, true);
+                    size_t expected = 0;
+                    for (const auto& entry : parser.getVersionDiff(a, b)) {
+                        if (entry.type == DiffEntry::UNCHANGED) {
+                            continue;
+                        }
+                        ++expected;
+                        bool found = false;
+                        for (const auto& c : composed) {
+                            found = found || (c.type == entry.type && c.section == entry.section &&
+                                              c.key == entry.key && c.oldValue == entry.oldValue &&
+                                              c.newValue == entry.newValue);
+                        }
+                        assert(found);
+                    }
+                    assert(composed.size() == expected);
+                }
+            }
+            assert(parser.getVersionDiff(1, 5, true).size() == 2);  // k1 removed, empty section t added
+            
+            auto history = parser.getHistoryAsJson();
+            assert(history[2]["parameters"] == 20 && history[2]["sections"] == 2);
+            assert(history[4]["parameters"] == 19);
+        }
+        std::cout << "PASS" << std::endl; ++passCount;
+    } catch (const std::exception& e) { std::cout << "FAIL: " << e.what() << std::endl; }
+    
+    // Test 21: Journal rollbacks, unreadable records and write failures
+    try {
+        ++testCount;
+        std::cout << "Test " << testCount << ": Journal rollback and damage ... ";
+        const std::string path = "./test_versioning_damage.journal";
+        std::filesystem::remove(path);
+        JournalOptions options;
+        options.checkpoint_interval = 2;
+        {
+            VersionedOopParser parser;
+            assert(parser.attachJournal(path, options));
+            for (int v = 1; v <= 4; ++v) {
+                parser.setParameter("s", "k", std::to_string(v));
+                assert(v == 1 ? parser.enableVersioning("V1") : parser.createVersion());
+            }
+            assert(parser.rollback(3));
+        }
+        
+        // A rollback is recovered, also after compaction
+        {
+            VersionedOopParser recovered;
+            assert(recovered.attachJournal(path, options));
+            assert(recovered.getCurrentVersion() == 3 && recovered.getValueByPath("/s/k") == "3");
+            assert(recovered.compactJournal());
+        }
+        {
+            VersionedOopParser compacted;
+            assert(compacted.attachJournal(path, options));
+            assert(compacted.getCurrentVersion() == 3 && compacted.getVersionCount() == 4);
+        }
+        
+        // A damaged record in the middle is skipped, not truncated with what follows:
+        // records are checkpoint 1, delta 2, checkpoint 3, delta 4, rollback 3
+        std::vector<std::string> lines;
+        {
+            std::ifstream in(path);
+            for (std::string line; std::getline(in, line);) {
+                lines.push_back(line);
+            }
+        }
+        assert(lines.size() == 5);
+        lines[1] = "{\"op\":\"delta\",garbage";
+        {
+            std::ofstream out(path, std::ios::trunc);
+            for (const auto& line : lines) {
+                out << line << "\n";
+            }
+        }
+        size_t damaged_size = std::filesystem::file_size(path);
+        {
+            VersionedOopParser recovered;
+            assert(recovered.attachJournal(path, options));
+            assert(std::filesystem::file_size(path) == damaged_size);
+            assert(recovered.getOldestVersion() == 3 && recovered.getVersionCount() == 2);
+            assert(recovered.getCurrentVersion() == 3 && recovered.getValueByPath("/s/k") == "3");
+        }
+        std::filesystem::remove(path);
+        
+#ifdef __linux__
+        // Writes to /dev/full fail: nothing is committed in memory
+        VersionedOopParser full;
+        full.setParameter("s", "k", "1");
+        assert(full.attachJournal("/dev/full", options));
+        assert(!full.enableVersioning("V1"));
+        assert(!full.isVersioningEnabled() && full.getVersionCount() == 0);
+        full.detachJournal();
+#endif
+        std::cout << "PASS" << std::endl; ++passCount;
+    } catch (const std::exception& e) { std::cout << "FAIL: " << e.what() << std::endl; }
+    
+    // Test 22: Empty sections survive delta replay and journal recovery
+    try {
+        ++testCount;
+        std::cout << "Test " << testCount << ": Empty sections in history ... ";
+        const std::string path = "./test_versioning_empty.journal";
+        std::filesystem::remove(path);
+        JournalOptions options;
+        options.checkpoint_interval = 2;
+        {
+            VersionedOopParser parser;
+            parser.setStorageMode(VersionStorageMode::DELTA, 4);
+            assert(parser.attachJournal(path, options));
+            parser.setParameter("s", "k", "1");
+            parser.enableVersioning("V1");
+            parser.setValueByPath("/t/x", "2");                      // v2
+            parser.createVersion();
+            parser.deleteByPath("/t/x");                             // v3: t kept, empty
+            parser.createVersion();
+            parser.setParameter("s", "k", "4");                      // v4: checkpoint with empty t
+            parser.createVersion();
+            parser.deleteByPath("/t");                               // v5: t removed
+            parser.createVersion();
+            for (size_t v = 1; v <= 5; ++v) {
+                assert(parser.rollback(v));
+                assert((parser.getSection("t") != nullptr) == (v >= 2 && v <= 4));
+            }
+        }
+        VersionedOopParser recovered;
+        assert(recovered.attachJournal(path, options));
+        assert(recovered.getCurrentVersion() == 5 && !recovered.getSection("t"));
+        for (size_t v = 1; v <= 5; ++v) {
+            assert(recovered.rollback(v));
+            const ConfigSectionData* section = recovered.getSection("t");
+            assert((section != nullptr) == (v >= 2 && v <= 4));
+            assert(!section || section->parameters.size() == (v == 2 ? 1u : 0u));
+        }
+        recovered.detachJournal();
+        std::filesystem::remove(path);
+        std::cout << "PASS" << std::endl; ++passCount;
+    } catch (const std::exception& e) { std::cout << "FAIL: " << e.what() << std::endl; }
+    
+    // Test 23: Pointers taken before a version do not write into it
+    try {
+        ++testCount;
+        std::cout << "Test " << testCount << ": Mutable pointers and snapshots ... ";
+        VersionedOopParser p;
+        p.setParameter("object", "id", "17030");
+        ConfigSectionData* s = p.getSection("object");
+        p.enableVersioning("V1");
+        s->parameters["id"].value = "999";
+        p.createVersion("V2");
+        s->parameters["id"].value = "1000";
+        assert(p.getVersionSnapshot(1)->getValueByPath("/object/id") == "17030");
+        assert(p.getVersionSnapshot(2)->getValueByPath("/object/id") == "999");
+        assert(p.getValueByPath("/object/id") == "1000");
+        std::cout << "PASS" << std::endl; ++passCount;
+    } catch (const std::exception& e) { std::cout << "FAIL: " << e.what() << std::endl; }
+    
     std::cout << "\n=== Summary ===" << std::endl;
     std::cout << "Total: " << testCount << " | Pass: " << passCount << " | Fail: " << (testCount - passCount) << std::endl;
     return passCount == testCount ? 0 : 1;
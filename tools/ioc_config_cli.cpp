@@ -11,6 +11,9 @@
  *   ioc-config convert <input> <output>  Convert between formats
  *   ioc-config merge <file1> <file2>     Merge two configurations
  *   ioc-config export-schema <output>    Export JSON schema
+ *   ioc-config query <file> <expression> List parameters matching a query
+ *   ioc-config generate-structs <output> [namespace] [struct] [schema]
+ *                                        Generate typed C++ config structs
  * 
  * @author Michele Bigi (mikbigi@gmail.com)
  * @date 2025-12-02
@@ -43,6 +46,8 @@ bool commandValidate(const std::vector<std::string>& args);
 bool commandConvert(const std::vector<std::string>& args);
 bool commandMerge(const std::vector<std::string>& args);
 bool commandExportSchema(const std::vector<std::string>& args);
+bool commandQuery(const std::vector<std::string>& args);
+bool commandGenerateStructs(const std::vector<std::string>& args);
 
 /**
  * @brief Print usage information
@@ -57,7 +62,11 @@ void printUsage(const std::string& programName) {
     std::cout << "  validate <file>           Validate configuration against schema\n";
     std::cout << "  convert <input> <output>  Convert between formats (OOP, JSON, YAML)\n";
     std::cout << "  merge <file1> <file2>     Merge two configurations\n";
-    std::cout << "  export-schema <output>    Export JSON schema to file\n";
+    std::cout << "  export-schema <output>    Export the default JSON schema to file\n";
+    std::cout << "  query <file> <expression> List parameters matching a query\n";
+    std::cout << "  generate-structs <output> [namespace] [struct] [schema]\n";
+    std::cout << "                            Generate typed C++ structs and loader from a JSON schema\n";
+    std::cout << "                            file (default schema if omitted)\n";
     std::cout << "  --version                 Show version information\n";
     std::cout << "  --help                    Show this help message\n\n";
     std::cout << COLOR_YELLOW << "Supported Formats:" << COLOR_RESET << "\n";
@@ -68,7 +77,9 @@ void printUsage(const std::string& programName) {
     std::cout << "  " << programName << " parse config.oop\n";
     std::cout << "  " << programName << " convert config.oop config.json\n";
     std::cout << "  " << programName << " validate config.yaml\n";
-    std::cout << "  " << programName << " export-schema schema.json\n\n";
+    std::cout << "  " << programName << " export-schema schema.json\n";
+    std::cout << "  " << programName << " query config.oop \"section=propag AND type=float AND value>1e-10\"\n";
+    std::cout << "  " << programName << " generate-structs ioc_config_structs.h myapp Config schema.json\n\n";
 }
 
 /**
@@ -111,6 +122,10 @@ bool parseCommand(const std::vector<std::string>& args) {
         return commandMerge(args);
     } else if (command == "export-schema") {
         return commandExportSchema(args);
+    } else if (command == "query") {
+        return commandQuery(args);
+    } else if (command == "generate-structs") {
+        return commandGenerateStructs(args);
     } else {
         std::cerr << COLOR_RED << "✗ Unknown command: " << command << COLOR_RESET << "\n";
         return false;
@@ -361,14 +376,10 @@ bool commandExportSchema(const std::vector<std::string>& args) {
     
     std::cout << COLOR_BLUE << "Exporting schema to: " << output_file << COLOR_RESET << "\n";
     
-    // Create a sample configuration to demonstrate schema
-    OopParser parser;
-    parser.setParameter("object", ".id", "'example'");
-    parser.setParameter("time", ".start", "'2024-01-01'");
-    
-    // Save as JSON to show structure
-    if (parser.saveToJson(output_file)) {
-        std::cout << COLOR_GREEN << "✓ Schema reference exported successfully" << COLOR_RESET << "\n";
+    // Readable back by generate-structs and ConfigSchema::loadJsonSchema()
+    ConfigSchema schema = OopParser::createDefaultSchema();
+    if (schema.saveJsonSchema(output_file)) {
+        std::cout << COLOR_GREEN << "✓ Schema exported successfully" << COLOR_RESET << "\n";
         return true;
     } else {
         std::cerr << COLOR_RED << "✗ Failed to export schema" << COLOR_RESET << "\n";
@@ -376,6 +387,91 @@ bool commandExportSchema(const std::vector<std::string>& args) {
     }
 }
 
+/**
+ * @brief Command: Query parameters
+ */
+bool commandQuery(const std::vector<std::string>& args) {
+    if (args.size() < 3) {
+        std::cerr << COLOR_RED << "✗ Missing filename or expression" << COLOR_RESET << "\n";
+        std::cerr << "Usage: ioc-config query <file> <expression>\n";
+        return false;
+    }
+    
+    std::string filepath = args[1];
+    std::string ext = getFileExtension(filepath);
+    
+    // The expression may be split across arguments when not quoted
+    std::string expression = args[2];
+    for (size_t i = 3; i < args.size(); ++i) {
+        expression += " " + args[i];
+    }
+    
+    ConfigQuery query(expression);
+    if (!query.isValid()) {
+        std::cerr << COLOR_RED << "✗ Invalid query: " << query.getError() << COLOR_RESET << "\n";
+        return false;
+    }
+    
+    OopParser parser;
+    bool loaded = false;
+    if (ext == ".json") {
+        loaded = parser.loadFromJson(filepath);
+    } else if (ext == ".yaml" || ext == ".yml") {
+        #ifdef IOC_CONFIG_YAML_SUPPORT
+        loaded = parser.loadFromYaml(filepath);
+        #else
+        std::cerr << COLOR_RED << "✗ YAML support not enabled" << COLOR_RESET << "\n";
+        return false;
+        #endif
+    } else {
+        loaded = parser.loadFromOop(filepath);
+    }
+    
+    if (!loaded) {
+        std::cerr << COLOR_RED << "✗ Failed to load file: " << parser.getLastError() << COLOR_RESET << "\n";
+        return false;
+    }
+    
+    size_t matches = parser.queryParameters(query, [](const ConfigSectionData& section, const ConfigParameter& param) {
+        std::cout << "/" << OopParser::escapePathToken(section.name) << "/" << OopParser::escapePathToken(param.key)
+                  << " = " << param.value << " (" << param.type << ")\n";
+    });
+    
+    std::cout << COLOR_GREEN << "✓ " << matches << " matching parameter(s)" << COLOR_RESET << "\n";
+    return true;
+}
+
+/**
+ * @brief Command: Generate typed configuration structs
+ */
+bool commandGenerateStructs(const std::vector<std::string>& args) {
+    if (args.size() < 2) {
+        std::cerr << COLOR_RED << "✗ Missing output file" << COLOR_RESET << "\n";
+        std::cerr << "Usage: ioc-config generate-structs <output> [namespace] [struct] [schema]\n";
+        return false;
+    }
+    
+    std::string output_file = args[1];
+    std::string namespace_name = args.size() > 2 ? args[2] : "ioc_config_generated";
+    std::string struct_name = args.size() > 3 ? args[3] : "Config";
+    
+    std::cout << COLOR_BLUE << "Generating structs to: " << output_file << COLOR_RESET << "\n";
+    
+    ConfigSchema schema = OopParser::createDefaultSchema();
+    if (args.size() > 4 && !schema.loadJsonSchema(args[4])) {
+        std::cerr << COLOR_RED << "✗ Failed to load schema: " << args[4] << COLOR_RESET << "\n";
+        return false;
+    }
+    if (!schema.saveCppHeader(output_file, namespace_name, struct_name)) {
+        std::cerr << COLOR_RED << "✗ Failed to write " << output_file << COLOR_RESET << "\n";
+        return false;
+    }
+    
+    std::cout << COLOR_GREEN << "✓ " << schema.sections.size() << " section struct(s) and load"
+              << struct_name << "() generated" << COLOR_RESET << "\n";
+    return true;
+}
+
 /**
  * @brief Main entry point
  */